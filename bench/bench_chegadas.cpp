@@ -0,0 +1,51 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "../include/Simulacao.hpp"
+
+/**
+ * @brief Mede o custo médio de cada evento de chegada na simulação de um arquivo de entrada.
+ *
+ * A simulação é executada no formato `resumo`, que imprime a sua linha de métricas. O tempo
+ * de `executar` é dividido pelo número de chegadas processadas (registros "armazenado" e
+ * "entregue"); a leitura do arquivo e o cálculo das rotas ficam de fora da medição.
+ *
+ * Uso: bench_chegadas [--escalonador heap|calendario|radix] <arquivo_de_entrada>...
+ */
+int main(int argc, char* argv[]) {
+    const std::string uso = std::string("Uso: ") + argv[0] + " [--escalonador heap|calendario|radix] <arquivo_de_entrada>...";
+    int primeiro = 1;
+    std::string escalonador = "heap";
+    if (argc > 2 && std::string(argv[1]) == "--escalonador") {
+        escalonador = argv[2];
+        primeiro = 3;
+    }
+    if (primeiro >= argc) {
+        std::cerr << uso << std::endl;
+        return 1;
+    }
+
+    try {
+        for (int i = primeiro; i < argc; ++i) {
+            OpcoesSimulacao opcoes;
+            opcoes.formato_log = FormatoLog::RESUMO;
+            opcoes.escalonador = Escalonador::tipo_por_nome(escalonador);
+            Simulacao sim(argv[i], opcoes);
+
+            auto inicio = std::chrono::steady_clock::now();
+            sim.executar();
+            double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+            const MetricasSimulacao& metricas = sim.obter_metricas();
+            long long chegadas = metricas.armazenamentos + metricas.entregas;
+            std::printf("\n%s [%s]: pacotes=%d chegadas=%lld tempo=%.3fs custo_por_chegada=%.1fns\n", argv[i], escalonador.c_str(),
+                        metricas.num_pacotes, chegadas, segundos, chegadas > 0 ? segundos * 1e9 / chegadas : 0.0);
+            std::fflush(stdout);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Ocorreu um erro: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "../include/EscalonadorHeap.hpp"
+
+/**
+ * @class HeapBinarioReferencia
+ * @brief Reprodução do escalonador original, usada como referência de desempenho.
+ *
+ * Min-heap binário de ponteiros para eventos alocados individualmente: cada comparação
+ * segue um ponteiro até o registro para ler a chave, e cada evento custa um `new` e um
+ * `delete`.
+ */
+class HeapBinarioReferencia {
+private:
+    Evento** heap;
+    int capacidade;
+    int tamanho;
+
+    int pai(int i) const { return (i - 1) / 2; }
+    int esquerda(int i) const { return 2 * i + 1; }
+    int direita(int i) const { return 2 * i + 2; }
+
+    void trocar(int i, int j) {
+        Evento* temp = heap[i];
+        heap[i] = heap[j];
+        heap[j] = temp;
+    }
+
+    void redimensionar() {
+        capacidade *= 2;
+        Evento** novo_heap = new Evento*[capacidade];
+        for (int i = 0; i < tamanho; ++i) {
+            novo_heap[i] = heap[i];
+        }
+        delete[] heap;
+        heap = novo_heap;
+    }
+
+    void subir(int i) {
+        while (i > 0 && heap[pai(i)]->obter_chave_prioridade() > heap[i]->obter_chave_prioridade()) {
+            trocar(i, pai(i));
+            i = pai(i);
+        }
+    }
+
+    void descer(int i) {
+        int min_index = i;
+        int l = esquerda(i);
+        if (l < tamanho && heap[l]->obter_chave_prioridade() < heap[min_index]->obter_chave_prioridade()) {
+            min_index = l;
+        }
+        int r = direita(i);
+        if (r < tamanho && heap[r]->obter_chave_prioridade() < heap[min_index]->obter_chave_prioridade()) {
+            min_index = r;
+        }
+        if (i != min_index) {
+            trocar(i, min_index);
+            descer(min_index);
+        }
+    }
+
+public:
+    HeapBinarioReferencia() : capacidade(100), tamanho(0) { heap = new Evento*[capacidade]; }
+
+    ~HeapBinarioReferencia() {
+        for (int i = 0; i < tamanho; ++i) {
+            delete heap[i];
+        }
+        delete[] heap;
+    }
+
+    void insere_evento(const Evento& evento) {
+        if (tamanho == capacidade) {
+            redimensionar();
+        }
+        heap[tamanho] = new Evento(evento);
+        tamanho++;
+        subir(tamanho - 1);
+    }
+
+    bool retira_proximo_evento(Evento& evento) {
+        if (tamanho == 0) return false;
+        Evento* raiz = heap[0];
+        heap[0] = heap[tamanho - 1];
+        tamanho--;
+        if (tamanho > 0) {
+            descer(0);
+        }
+        evento = *raiz;
+        delete raiz;
+        return true;
+    }
+};
+
+/**
+ * @brief Mede uma fila de eventos no modelo "hold" com `pendentes` eventos na fila.
+ *
+ * A fila é preenchida com `pendentes` chegadas em tempos sorteados e, em seguida, cada
+ * operação medida retira o menor evento e agenda outro um pouco mais à frente, de modo que
+ * o tamanho da fila permanece constante, como no regime estacionário da simulação.
+ * @param fila A fila de eventos (vazia).
+ * @param pendentes Quantidade de eventos mantidos na fila.
+ * @param operacoes Quantidade de pares retira/insere medidos.
+ * @return O tempo médio, em nanossegundos, de cada par retira/insere.
+ */
+template <typename Fila>
+static double medir_hold(Fila& fila, int pendentes, int operacoes) {
+    std::mt19937 aleatorio(1);
+    for (int i = 0; i < pendentes; ++i) {
+        fila.insere_evento(Evento::chegada((int)(aleatorio() % 1000), i % 1000000, i, 0));
+    }
+
+    long long soma = 0;
+    Evento evento;
+    auto inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < operacoes; ++i) {
+        fila.retira_proximo_evento(evento);
+        soma += evento.tempo;
+        fila.insere_evento(Evento::chegada(evento.tempo + 1 + (int)(aleatorio() % 1000), i % 1000000, i, 0));
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    if (soma < 0) std::printf("%lld\n", soma); // Impede que o laço seja descartado.
+    return segundos * 1e9 / operacoes;
+}
+
+/**
+ * @brief Compara o heap d-ário do escalonador com o heap binário de ponteiros original.
+ *
+ * Para cada quantidade de eventos pendentes (10^3 a 10^7, ou as passadas na linha de
+ * comando), imprime o custo médio de um par retira/insere no heap de referência e no
+ * EscalonadorHeap com aridades 2, 4 e 8.
+ *
+ * Uso: bench_escalonador [pendentes...]
+ */
+int main(int argc, char* argv[]) {
+    const int OPERACOES = 1000000;
+    int tamanhos_padrao[] = {1000, 10000, 100000, 1000000, 10000000};
+    int num_tamanhos = argc > 1 ? argc - 1 : 5;
+
+    std::printf("%10s %12s %12s %12s %12s\n", "pendentes", "referencia", "heap d=2", "heap d=4", "heap d=8");
+    for (int t = 0; t < num_tamanhos; ++t) {
+        int pendentes = argc > 1 ? std::atoi(argv[t + 1]) : tamanhos_padrao[t];
+        if (pendentes < 1) {
+            std::cerr << "Uso: " << argv[0] << " [pendentes...]" << std::endl;
+            return 1;
+        }
+
+        std::printf("%10d", pendentes);
+        {
+            HeapBinarioReferencia referencia;
+            std::printf(" %10.1fns", medir_hold(referencia, pendentes, OPERACOES));
+        }
+        for (int aridade = 2; aridade <= 8; aridade *= 2) {
+            EscalonadorHeap heap(100, aridade);
+            std::printf(" %10.1fns", medir_hold(heap, pendentes, OPERACOES));
+        }
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+    return 0;
+}
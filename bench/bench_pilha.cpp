@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include "../include/Pilha.hpp"
+
+/**
+ * @class PilhaEncadeadaReferencia
+ * @brief Reprodução da pilha original, usada como referência de desempenho.
+ *
+ * Pilha encadeada em que cada elemento ocupa um nó alocado com `new` no empilhamento e
+ * liberado com `delete` no desempilhamento.
+ */
+template <typename T>
+class PilhaEncadeadaReferencia {
+private:
+    struct No {
+        T dado;
+        No* proximo;
+    };
+
+    No* topo;
+    int tamanho;
+
+public:
+    PilhaEncadeadaReferencia() : topo(nullptr), tamanho(0) {}
+
+    ~PilhaEncadeadaReferencia() {
+        while (!esta_vazia()) desempilha();
+    }
+
+    void empilha(T elemento) {
+        topo = new No{elemento, topo};
+        tamanho++;
+    }
+
+    T desempilha() {
+        if (esta_vazia()) {
+            throw std::out_of_range("A pilha está vazia.");
+        }
+        No* no_a_remover = topo;
+        T dado_removido = no_a_remover->dado;
+        topo = topo->proximo;
+        delete no_a_remover;
+        tamanho--;
+        return dado_removido;
+    }
+
+    bool esta_vazia() const { return topo == nullptr; }
+};
+
+/**
+ * @brief Mede empilhamentos e desempilhamentos no padrão de uso de uma seção de armazém.
+ *
+ * Cada rodada empilha 64 elementos, desempilha todos (como na remoção para transporte),
+ * reempilha os 16 mais recentes (os que não couberam no transporte) e esvazia a pilha.
+ * @param pilha A pilha (vazia) a medir.
+ * @param rodadas Quantidade de rodadas.
+ * @return Milhões de operações (empilhamentos mais desempilhamentos) por segundo.
+ */
+template <typename PilhaT>
+static double medir_secao(PilhaT& pilha, int rodadas) {
+    const int CHEIA = 64, REEMPILHADOS = 16;
+    static int elementos[CHEIA];
+    int* removidos[CHEIA];
+    long long soma = 0;
+
+    auto inicio = std::chrono::steady_clock::now();
+    for (int r = 0; r < rodadas; ++r) {
+        for (int i = 0; i < CHEIA; ++i) pilha.empilha(&elementos[(r + i) % CHEIA]);
+        for (int i = 0; i < CHEIA; ++i) removidos[i] = pilha.desempilha();
+        for (int i = CHEIA - REEMPILHADOS; i < CHEIA; ++i) pilha.empilha(removidos[i]);
+        while (!pilha.esta_vazia()) soma += pilha.desempilha() - elementos;
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    if (soma < 0) std::printf("%lld\n", soma); // Impede que o laço seja descartado.
+
+    long long operacoes = (long long)rodadas * 2 * (CHEIA + REEMPILHADOS);
+    return operacoes / segundos / 1e6;
+}
+
+/**
+ * @brief Mede uma sequência de `n` empilhamentos seguida de `n` desempilhamentos.
+ * @param pilha A pilha (vazia) a medir.
+ * @param n Quantidade de elementos.
+ * @return Milhões de operações por segundo.
+ */
+template <typename PilhaT>
+static double medir_sequencia(PilhaT& pilha, int n) {
+    static int elementos[1024];
+    long long soma = 0;
+
+    auto inicio = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) pilha.empilha(&elementos[i % 1024]);
+    while (!pilha.esta_vazia()) soma += pilha.desempilha() - elementos;
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    if (soma < 0) std::printf("%lld\n", soma);
+
+    return 2.0 * n / segundos / 1e6;
+}
+
+/**
+ * @brief Compara a Pilha sobre array contíguo com a pilha encadeada original.
+ *
+ * Imprime a taxa de operações de cada uma no padrão de uma seção de armazém e em uma
+ * sequência longa de empilhamentos e desempilhamentos.
+ *
+ * Uso: bench_pilha
+ */
+int main() {
+    const int RODADAS = 200000;
+    const int SEQUENCIA = 10000000;
+
+    std::printf("%-24s %14s %14s\n", "padrao", "encadeada", "Pilha");
+    {
+        PilhaEncadeadaReferencia<int*> encadeada;
+        Pilha<int*> pilha;
+        double taxa_encadeada = medir_secao(encadeada, RODADAS);
+        double taxa_pilha = medir_secao(pilha, RODADAS);
+        std::printf("%-24s %8.1f Mop/s %8.1f Mop/s\n", "secao (64, 16 de volta)", taxa_encadeada, taxa_pilha);
+    }
+    {
+        PilhaEncadeadaReferencia<int*> encadeada;
+        Pilha<int*> pilha;
+        double taxa_encadeada = medir_sequencia(encadeada, SEQUENCIA);
+        double taxa_pilha = medir_sequencia(pilha, SEQUENCIA);
+        std::printf("%-24s %8.1f Mop/s %8.1f Mop/s\n", "sequencia de 10^7", taxa_encadeada, taxa_pilha);
+    }
+    return 0;
+}
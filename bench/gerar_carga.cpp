@@ -0,0 +1,147 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+
+/**
+ * @brief Gera uma carga sintética reprodutível no formato de entrada da simulação.
+ *
+ * Os armazéns formam um anel com cordas ligando cada armazém `i < armazens / 2` ao armazém
+ * `i + armazens / 2`, escrito como lista de arestas. Os pacotes são postados à taxa de um
+ * por unidade de tempo, com origem e destino sorteados, então a quantidade de pacotes em
+ * circulação não depende do total de pacotes: o custo por chegada deve ser o mesmo para
+ * qualquer `pacotes`.
+ * @param pacotes Número de pacotes (até 10^6, o limite dos IDs na chave de prioridade).
+ * @param armazens Número de armazéns (pelo menos 3).
+ * @param semente Semente do gerador pseudoaleatório.
+ */
+static void gerar_sintetica(int pacotes, int armazens, unsigned semente) {
+    std::mt19937 aleatorio(semente);
+
+    // Capacidade, latência, intervalo e custo de remoção.
+    std::printf("5\n5\n10\n1\n");
+    int cordas = armazens >= 4 ? armazens / 2 : 0; // Com 3 armazéns, a corda repetiria o anel.
+    std::printf("%d arestas %d\n", armazens, armazens + cordas);
+    for (int i = 0; i < armazens; ++i) {
+        std::printf("%d %d\n", i, (i + 1) % armazens);
+    }
+    for (int i = 0; i < cordas; ++i) {
+        std::printf("%d %d\n", i, i + armazens / 2);
+    }
+
+    std::printf("%d\n", pacotes);
+    for (int i = 0; i < pacotes; ++i) {
+        int origem = (int)(aleatorio() % armazens);
+        int destino = (int)(aleatorio() % (armazens - 1));
+        if (destino >= origem) ++destino;
+        std::printf("%d pac %d org %d dst %d\n", i, i + 1, origem, destino);
+    }
+}
+
+/**
+ * @brief Escala uma entrada existente repetindo os seus pacotes `fator` vezes.
+ *
+ * A configuração e a topologia (matriz de adjacência ou lista de arestas) são copiadas sem
+ * alteração. A cópia `c` dos pacotes é postada `c * deslocamento` unidades de tempo depois
+ * da original e os IDs são renumerados de forma sequencial a partir de 1. Com um deslocamento maior que a
+ * duração da simulação original, as cópias não disputam os mesmos transportes, mas todas as
+ * chegadas ficam pendentes no escalonador desde o início.
+ * @param arquivo A entrada original.
+ * @param fator Quantidade de cópias dos pacotes.
+ * @param deslocamento Distância, em unidades de tempo, entre cópias consecutivas.
+ * @return Falso se a entrada não pôde ser lida ou excede o limite de 10^6 pacotes.
+ */
+static bool gerar_escalada(const char* arquivo, int fator, int deslocamento) {
+    std::ifstream entrada(arquivo);
+    int configuracao[4];
+    for (int i = 0; i < 4; ++i) {
+        if (!(entrada >> configuracao[i])) return false;
+    }
+
+    int armazens;
+    std::string token;
+    if (!(entrada >> armazens >> token)) return false;
+    std::string topologia;
+    if (token == "arestas") {
+        int arestas;
+        if (!(entrada >> arestas)) return false;
+        topologia = std::to_string(armazens) + " arestas " + std::to_string(arestas) + "\n";
+        for (int i = 0; i < arestas; ++i) {
+            int u, v;
+            if (!(entrada >> u >> v)) return false;
+            topologia += std::to_string(u) + " " + std::to_string(v) + "\n";
+        }
+    } else {
+        topologia = std::to_string(armazens) + "\n";
+        for (int i = 0; i < armazens * armazens; ++i) {
+            if (i > 0 && !(entrada >> token)) return false;
+            topologia += token + ((i + 1) % armazens == 0 ? "\n" : " ");
+        }
+    }
+
+    int pacotes;
+    if (!(entrada >> pacotes) || pacotes < 0 || (long long)pacotes * fator > 1000000) return false;
+    int* tempos = new int[pacotes > 0 ? pacotes : 1];
+    int* origens = new int[pacotes > 0 ? pacotes : 1];
+    int* destinos = new int[pacotes > 0 ? pacotes : 1];
+    for (int i = 0; i < pacotes; ++i) {
+        std::string pac, org, dst;
+        int id;
+        if (!(entrada >> tempos[i] >> pac >> id >> org >> origens[i] >> dst >> destinos[i])) {
+            delete[] tempos;
+            delete[] origens;
+            delete[] destinos;
+            return false;
+        }
+    }
+
+    std::printf("%d\n%d\n%d\n%d\n", configuracao[0], configuracao[1], configuracao[2], configuracao[3]);
+    std::fputs(topologia.c_str(), stdout);
+    std::printf("%d\n", pacotes * fator);
+    for (int c = 0; c < fator; ++c) {
+        for (int i = 0; i < pacotes; ++i) {
+            std::printf("%d pac %d org %d dst %d\n", tempos[i] + c * deslocamento, c * pacotes + i + 1,
+                        origens[i], destinos[i]);
+        }
+    }
+    delete[] tempos;
+    delete[] origens;
+    delete[] destinos;
+    return true;
+}
+
+/**
+ * @brief Gerador de cargas para os benchmarks da simulação.
+ *
+ * Uso: gerar_carga sintetica <pacotes> <armazens> [semente]
+ *      gerar_carga escalar <arquivo> <fator> <deslocamento>
+ *
+ * A carga é escrita na saída padrão.
+ */
+int main(int argc, char* argv[]) {
+    const std::string uso = std::string("Uso: ") + argv[0] + " sintetica <pacotes> <armazens> [semente]\n" +
+        "     " + argv[0] + " escalar <arquivo> <fator> <deslocamento>";
+    std::string modo = argc > 1 ? argv[1] : "";
+
+    if (modo == "sintetica" && (argc == 4 || argc == 5)) {
+        int pacotes = std::atoi(argv[2]);
+        int armazens = std::atoi(argv[3]);
+        unsigned semente = argc == 5 ? (unsigned)std::strtoul(argv[4], nullptr, 10) : 1u;
+        if (pacotes >= 0 && pacotes <= 1000000 && armazens >= 3) {
+            gerar_sintetica(pacotes, armazens, semente);
+            return 0;
+        }
+    } else if (modo == "escalar" && argc == 5) {
+        int fator = std::atoi(argv[3]);
+        int deslocamento = std::atoi(argv[4]);
+        if (fator >= 1 && deslocamento >= 0) {
+            if (gerar_escalada(argv[2], fator, deslocamento)) return 0;
+            std::cerr << "Entrada inválida ou grande demais para escalar: " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+    std::cerr << uso << std::endl;
+    return 1;
+}
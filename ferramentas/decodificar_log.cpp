@@ -0,0 +1,37 @@
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+#include "../include/RegistroLog.hpp"
+
+/**
+ * @brief Converte um log binário da simulação (`--log binario` ou `--log binario-delta`) para o
+ *        formato de texto, idêntico ao que a simulação escreveria com `--log texto`.
+ *
+ * Uso: decodificar_log [arquivo_binario]. Sem argumento, lê da entrada padrão.
+ */
+int main(int argc, char* argv[]) {
+    if (argc > 2) {
+        std::cerr << "Uso: " << argv[0] << " [arquivo_binario]" << std::endl;
+        return 1;
+    }
+
+    int entrada = 0;
+    if (argc == 2) {
+        entrada = open(argv[1], O_RDONLY);
+        if (entrada < 0) {
+            std::cerr << "Erro ao abrir o arquivo de entrada." << std::endl;
+            return 1;
+        }
+    }
+
+    try {
+        SaidaLog saida;
+        decodificar_log_binario(entrada, saida);
+        saida.descarregar();
+    } catch (const std::exception& e) {
+        std::cerr << "Ocorreu um erro: " << e.what() << std::endl;
+        return 1;
+    }
+    if (entrada != 0) close(entrada);
+    return 0;
+}
@@ -9,7 +9,9 @@
  * @brief Representa uma instalação de armazenamento para pacotes.
  *
  * Um armazém contém múltiplas seções, cada uma sendo uma pilha de pacotes
- * destinada a um armazém de destino específico.
+ * destinada a um armazém de destino específico. Só existem seções para os
+ * armazéns vizinhos, e uma pequena tabela de espalhamento leva o ID do vizinho
+ * à posição da sua seção em tempo constante.
  */
 class Armazem {
 private:
@@ -17,30 +19,46 @@ private:
     
     // Cada índice do array corresponde a uma seção para um armazém adjacente.
     Pilha<Pacote*>* secoes; /// @brief Array de pilhas, onde cada pilha representa uma seção de pacotes.
-    
-    int num_secoes; // igual ao número total de armazéns na simulação
+    int* vizinho_da_secao;  /// @brief ID do armazém vizinho atendido por cada seção.
+    int num_secoes;         /// @brief Número de seções (vizinhos distintos).
+
+    int* tabela_secoes;     /// @brief Tabela de espalhamento (sondagem linear): índice da seção ou -1.
+    int mascara_tabela;     /// @brief Tamanho da tabela menos 1 (o tamanho é potência de 2).
+
+    /**
+     * @brief Procura a seção de um armazém vizinho.
+     * @param id_vizinho O ID do armazém vizinho.
+     * @return O índice da seção, ou -1 se o armazém não for vizinho.
+     */
+    int indice_secao(int id_vizinho) const;
 
 public:
     /**
      * @brief Constrói um novo objeto Armazem.
      *
      * @param id O identificador para o armazém.
-     * @param total_armazens O número total de armazéns na simulação, usado para alocar as seções.
+     * @param vizinhos IDs dos armazéns vizinhos; cada um recebe uma seção (repetições são ignoradas).
+     * @param num_vizinhos O número de posições em `vizinhos`.
      */
-    Armazem(int id, int total_armazens);
+    Armazem(int id, const int* vizinhos, int num_vizinhos);
 
     /**
      * @brief Destrói o objeto Armazem, liberando os recursos alocados.
      */
     ~Armazem();
 
+    Armazem(const Armazem&) = delete;
+    Armazem& operator=(const Armazem&) = delete;
+
     /**
      * @brief Adiciona um pacote à seção de armazenamento apropriada.
      *
      * O pacote é colocado na pilha correspondente ao seu próximo destino na rota.
      * @param pacote O pacote a ser armazenado.
+     * @param proximo_destino O próximo armazém da rota do pacote (-1 se a rota estiver completa).
+     * @return Verdadeiro se a seção estava vazia antes do pacote (a rota precisa de transporte).
      */
-    void armazenar_pacote(Pacote* pacote);
+    bool armazenar_pacote(Pacote* pacote, int proximo_destino);
     
     /**
      * @brief Recupera a seção de empilhamento para um armazém de destino específico.
@@ -1,65 +1,89 @@
 #ifndef ESCALONADOR_HPP
 #define ESCALONADOR_HPP
 
+#include <string>
 #include "Evento.hpp"
+#include "VetorDinamico.hpp"
+
+/**
+ * @enum TipoEscalonador
+ * @brief Implementações disponíveis para a fila de eventos da simulação.
+ */
+enum class TipoEscalonador {
+    HEAP,       ///< Min-heap d-ário (padrão), O(log n) por operação.
+    CALENDARIO, ///< Fila de calendário (baldes por faixa de chave), O(1) amortizado por operação.
+    RADIX       ///< Radix heap sobre a chave de 64 bits, O(log C) amortizado por operação.
+};
 
 /**
  * @class Escalonador
- * @brief Gerencia uma fila de prioridade de eventos usando um min-heap.
+ * @brief Interface comum para as filas de prioridade de eventos.
  *
  * Esta classe é responsável por agendar e recuperar eventos com base em seu tempo,
  * garantindo que o evento com o menor tempo seja sempre processado primeiro.
+ * Toda implementação deve retirar os eventos em ordem crescente de
+ * `Evento::obter_chave_prioridade()`, o que inclui o desempate por tipo e IDs.
  */
 class Escalonador {
-private:
-    Evento** heap;      ///< Ponteiro para o array que armazena os elementos do heap.
-    int capacidade;     ///< A capacidade atual do array do heap.
-    int tamanho;        ///< O número atual de elementos no heap.
-
-    /** @brief Move um elemento para cima no heap para manter a propriedade do heap. */
-    void subir(int i);
-    /** @brief Move um elemento para baixo no heap para manter a propriedade do heap. */
-    void descer(int i);
-    /** @brief Retorna o índice do nó pai. */
-    int pai(int i) { return (i - 1) / 2; }
-    /** @brief Retorna o índice do filho esquerdo. */
-    int esquerda(int i) { return 2 * i + 1; }
-    /** @brief Retorna o índice do filho direito. */
-    int direita(int i) { return 2 * i + 2; }
-    /** @brief Troca dois elementos no heap. */
-    void trocar(int i, int j);
-    /** @brief Redimensiona o array do heap quando a capacidade é excedida. */
-    void redimensionar();
-
 public:
     /**
-     * @brief Constrói um novo Escalonador com uma capacidade inicial.
-     * @param capacidade_inicial A capacidade inicial da fila de eventos.
+     * @brief Destrutor virtual padrão.
      */
-    Escalonador(int capacidade_inicial = 100);
+    virtual ~Escalonador() = default;
 
     /**
-     * @brief Destrói o Escalonador, liberando a memória alocada.
+     * @brief Insere um novo evento na fila de prioridade.
+     * @param evento O evento a ser adicionado (copiado pelo escalonador).
      */
-    ~Escalonador();
+    virtual void insere_evento(const Evento& evento) = 0;
 
     /**
-     * @brief Insere um novo evento na fila de prioridade.
-     * @param evento O evento a ser adicionado.
+     * @brief Insere um lote de eventos de uma só vez.
+     *
+     * A implementação padrão insere os eventos um a um; implementações que se beneficiam
+     * de construção em lote (como o heap) a sobrescrevem.
+     * @param lote Os eventos a serem adicionados.
      */
-    void insere_evento(Evento* evento);
+    virtual void insere_eventos(const VetorDinamico<Evento>& lote) {
+        for (const Evento& evento : lote) {
+            insere_evento(evento);
+        }
+    }
 
     /**
-     * @brief Remove e retorna o evento com o menor tempo (a raiz do heap).
-     * @return O próximo evento a ser processado, ou nullptr se a fila estiver vazia.
+     * @brief Remove o evento com a menor chave de prioridade.
+     * @param evento Recebe uma cópia do próximo evento a ser processado.
+     * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
      */
-    Evento* retira_proximo_evento();
+    virtual bool retira_proximo_evento(Evento& evento) = 0;
+
+    /**
+     * @brief Consulta, sem remover, a menor chave de prioridade pendente.
+     * @param chave Recebe a chave do evento que `retira_proximo_evento` retiraria.
+     * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+     */
+    virtual bool consulta_proxima_chave(long long& chave) const = 0;
 
     /**
      * @brief Verifica se a fila de eventos está vazia.
      * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
      */
-    bool vazio() const;
+    virtual bool vazio() const = 0;
+
+    /**
+     * @brief Cria um escalonador do tipo pedido.
+     * @param tipo A implementação desejada.
+     * @return Um novo escalonador, que passa a pertencer a quem chamou.
+     */
+    static Escalonador* criar(TipoEscalonador tipo);
+
+    /**
+     * @brief Converte o nome de uma implementação ("heap", "calendario", "radix") em seu tipo.
+     * @param nome O nome da implementação.
+     * @return O tipo correspondente.
+     * @throws std::invalid_argument Se o nome não corresponder a nenhuma implementação.
+     */
+    static TipoEscalonador tipo_por_nome(const std::string& nome);
 };
 
 #endif // ESCALONADOR_HPP
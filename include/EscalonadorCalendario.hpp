@@ -0,0 +1,99 @@
+#ifndef ESCALONADOR_CALENDARIO_HPP
+#define ESCALONADOR_CALENDARIO_HPP
+
+#include "Escalonador.hpp"
+
+/**
+ * @class EscalonadorCalendario
+ * @brief Implementação do Escalonador como uma fila de calendário.
+ *
+ * O espaço das chaves de prioridade é dividido em janelas de largura fixa e cada janela
+ * é mapeada, de forma circular, para um balde. Cada balde mantém seus eventos ordenados
+ * pela chave, de modo que o menor evento de uma janela está sempre no início do balde.
+ * As janelas são calculadas a partir da chave, e não do tempo, para que a ordem das
+ * janelas siga sempre a ordem de retirada, mesmo quando IDs grandes fazem a chave
+ * avançar além do seu tempo. Como o tempo da simulação (o termo dominante da chave)
+ * avança de forma quase monótona, inserção e remoção custam O(1) amortizado. O número de
+ * baldes e a largura das janelas são recalculados quando a quantidade de eventos cresce ou
+ * diminui demais.
+ */
+class EscalonadorCalendario : public Escalonador {
+private:
+    /**
+     * @struct Balde
+     * @brief Eventos de uma posição do calendário, ordenados pela chave em [inicio, fim).
+     */
+    struct Balde {
+        Evento* eventos;    ///< Array de eventos do balde (nullptr enquanto vazio).
+        int inicio;         ///< Posição do menor evento do balde.
+        int fim;            ///< Uma posição após o maior evento do balde.
+        int capacidade;     ///< Tamanho do array `eventos`.
+    };
+
+    Balde* baldes;          ///< Array circular de baldes.
+    int num_baldes;         ///< Quantidade de baldes (sempre potência de 2).
+    long long largura;      ///< Largura de cada janela, em unidades de chave (múltiplo de `Evento::PESO_TEMPO`).
+    long long janela_atual; ///< Janela do último evento retirado; nenhum evento pendente é anterior a ela.
+    int tamanho;            ///< O número atual de eventos na fila.
+    mutable int balde_minimo;          ///< Balde do menor evento, já localizado (-1 se precisa ser buscado).
+    mutable long long janela_minimo;   ///< Janela do menor evento, válida junto com `balde_minimo`.
+
+    /** @brief Quantidade mínima de baldes mantida pelo calendário. */
+    static const int MIN_BALDES = 16;
+
+    /** @brief Retorna a janela a que pertence uma chave de prioridade. */
+    long long janela_da_chave(long long chave) const { return chave / largura; }
+    /** @brief Retorna o balde correspondente a uma janela. */
+    Balde& balde_da_janela(long long janela) { return baldes[(int)(janela & (num_baldes - 1))]; }
+    /** @brief Localiza o balde do menor evento pendente, reaproveitando a última busca. */
+    int localizar_minimo(long long& janela) const;
+    /** @brief Percorre os baldes em busca do menor evento pendente (fila não vazia). */
+    int buscar_minimo(long long& janela) const;
+    /** @brief Insere um evento em um balde, mantendo a ordenação por chave. */
+    void inserir_no_balde(Balde& balde, const Evento& evento);
+    /** @brief Retira o primeiro evento de um balde. */
+    void retirar_do_balde(Balde& balde, Evento& evento);
+    /** @brief Redistribui os eventos em uma nova quantidade de baldes, recalculando a largura. */
+    void reconstruir(int novo_num_baldes);
+
+public:
+    /**
+     * @brief Constrói uma fila de calendário vazia.
+     * @param num_baldes_inicial A quantidade inicial de baldes (arredondada para potência de 2).
+     * @param largura_inicial A largura inicial de cada janela de tempo.
+     */
+    EscalonadorCalendario(int num_baldes_inicial = MIN_BALDES, int largura_inicial = 1);
+
+    /**
+     * @brief Destrói a fila de calendário, liberando a memória alocada.
+     */
+    ~EscalonadorCalendario() override;
+
+    /**
+     * @brief Insere um novo evento na fila de prioridade.
+     * @param evento O evento a ser adicionado.
+     */
+    void insere_evento(const Evento& evento) override;
+
+    /**
+     * @brief Remove o evento com a menor chave de prioridade.
+     * @param evento Recebe uma cópia do próximo evento a ser processado.
+     * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
+     */
+    bool retira_proximo_evento(Evento& evento) override;
+
+    /**
+     * @brief Consulta, sem remover, a menor chave de prioridade pendente.
+     * @param chave Recebe a chave do próximo evento.
+     * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+     */
+    bool consulta_proxima_chave(long long& chave) const override;
+
+    /**
+     * @brief Verifica se a fila de eventos está vazia.
+     * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
+     */
+    bool vazio() const override;
+};
+
+#endif // ESCALONADOR_CALENDARIO_HPP
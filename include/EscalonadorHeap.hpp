@@ -0,0 +1,99 @@
+#ifndef ESCALONADOR_HEAP_HPP
+#define ESCALONADOR_HEAP_HPP
+
+#include "Escalonador.hpp"
+
+/**
+ * @class EscalonadorHeap
+ * @brief Implementação do Escalonador usando um min-heap d-ário.
+ *
+ * Os eventos são guardados por valor em um pool de registros mantido pelo próprio
+ * escalonador; o heap armazena pares (chave, índice do pool) de forma contígua, então
+ * as comparações não precisam acessar o registro do evento. Posições liberadas do pool
+ * são reaproveitadas por meio de uma lista de livres, de modo que, após o pool atingir
+ * seu tamanho máximo, agendar e retirar eventos não aloca memória.
+ *
+ * A aridade do heap (2, 4 ou 8) é escolhida na construção. O array do heap é deslocado
+ * de forma que os filhos de um mesmo nó comecem sempre em um limite de linha de cache.
+ */
+class EscalonadorHeap : public Escalonador {
+private:
+    /**
+     * @struct EntradaHeap
+     * @brief Elemento do heap: a chave de prioridade do evento e sua posição no pool.
+     */
+    struct EntradaHeap {
+        long long chave;    ///< Chave de prioridade do evento.
+        int indice;         ///< Índice do evento no pool.
+    };
+
+    Evento* eventos;        ///< Pool de registros de eventos, indexado por `EntradaHeap::indice`.
+    int* livres;            ///< Pilha de índices do pool que estão disponíveis.
+    int num_livres;         ///< Quantidade de índices na pilha de livres.
+    EntradaHeap* memoria_heap; ///< Bloco alocado para o heap (inclui a folga de alinhamento).
+    EntradaHeap* heap;      ///< Início lógico do heap dentro de `memoria_heap`, já alinhado.
+    int aridade;            ///< Número de filhos por nó do heap.
+    int capacidade;         ///< A capacidade atual do heap e do pool.
+    int tamanho;            ///< O número atual de elementos no heap.
+
+    /** @brief Move um elemento para cima no heap para manter a propriedade do heap. */
+    void subir(int i);
+    /** @brief Move um elemento para baixo no heap para manter a propriedade do heap. */
+    void descer(int i);
+    /** @brief Retorna o índice do nó pai. */
+    int pai(int i) const { return (i - 1) / aridade; }
+    /** @brief Retorna o índice do primeiro filho. */
+    int primeiro_filho(int i) const { return aridade * i + 1; }
+    /** @brief Aloca um heap alinhado com a capacidade dada e copia os elementos atuais. */
+    void alocar_heap(int nova_capacidade);
+    /** @brief Aumenta a capacidade do heap e do pool para pelo menos `nova_capacidade`. */
+    void reservar(int nova_capacidade);
+
+public:
+    /**
+     * @brief Constrói um novo EscalonadorHeap com uma capacidade inicial.
+     * @param capacidade_inicial A capacidade inicial da fila de eventos.
+     * @param aridade O número de filhos por nó do heap (2, 4 ou 8).
+     * @throws std::invalid_argument Se a aridade não for 2, 4 ou 8.
+     */
+    EscalonadorHeap(int capacidade_inicial = 100, int aridade = 4);
+
+    /**
+     * @brief Destrói o EscalonadorHeap, liberando a memória alocada.
+     */
+    ~EscalonadorHeap() override;
+
+    /**
+     * @brief Insere um novo evento na fila de prioridade.
+     * @param evento O evento a ser adicionado (copiado para o pool).
+     */
+    void insere_evento(const Evento& evento) override;
+
+    /**
+     * @brief Insere um lote de eventos, reservando espaço uma vez e montando o heap em O(n).
+     * @param lote Os eventos a serem adicionados.
+     */
+    void insere_eventos(const VetorDinamico<Evento>& lote) override;
+
+    /**
+     * @brief Remove o evento com o menor tempo (a raiz do heap).
+     * @param evento Recebe uma cópia do próximo evento a ser processado.
+     * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
+     */
+    bool retira_proximo_evento(Evento& evento) override;
+
+    /**
+     * @brief Consulta, sem remover, a menor chave de prioridade pendente.
+     * @param chave Recebe a chave do próximo evento.
+     * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+     */
+    bool consulta_proxima_chave(long long& chave) const override;
+
+    /**
+     * @brief Verifica se a fila de eventos está vazia.
+     * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
+     */
+    bool vazio() const override;
+};
+
+#endif // ESCALONADOR_HEAP_HPP
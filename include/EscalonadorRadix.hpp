@@ -0,0 +1,81 @@
+#ifndef ESCALONADOR_RADIX_HPP
+#define ESCALONADOR_RADIX_HPP
+
+#include "Escalonador.hpp"
+
+/**
+ * @class EscalonadorRadix
+ * @brief Implementação do Escalonador como um radix heap sobre a chave de 64 bits.
+ *
+ * O relógio da simulação nunca retrocede, então a chave de qualquer evento inserido é,
+ * em geral, maior ou igual à do último evento retirado. Nesse caso monótono, o radix heap
+ * agrupa os eventos em 65 baldes conforme o bit mais significativo em que sua chave difere
+ * da última chave retirada; cada evento desce de balde no máximo 64 vezes, o que dá custo
+ * amortizado O(log C) por operação, sem comparações entre eventos na inserção.
+ */
+class EscalonadorRadix : public Escalonador {
+private:
+    /**
+     * @struct Balde
+     * @brief Conjunto não ordenado de eventos com o mesmo índice de balde.
+     */
+    struct Balde {
+        Evento* eventos;    ///< Array de eventos do balde (nullptr enquanto vazio).
+        int tamanho;        ///< Quantidade de eventos no balde.
+        int capacidade;     ///< Tamanho do array `eventos`.
+        long long menor;    ///< Menor chave do balde (válida enquanto ele não estiver vazio).
+    };
+
+    /** @brief Quantidade de baldes: um para a chave igual à última e um por bit. */
+    static const int NUM_BALDES = 65;
+
+    Balde baldes[NUM_BALDES];   ///< Baldes indexados pelo bit mais alto de `chave ^ ultima_chave`.
+    long long ultima_chave;     ///< Chave do último evento retirado (base dos índices dos baldes).
+    int tamanho;                ///< O número atual de eventos na fila.
+
+    /** @brief Calcula o balde de uma chave em relação a `ultima_chave`. */
+    int indice_balde(long long chave) const;
+    /** @brief Acrescenta um evento a um balde. */
+    void adicionar_no_balde(int indice, const Evento& evento);
+    /** @brief Redistribui todos os eventos em relação a uma nova base menor que a atual. */
+    void rebasear(long long nova_base);
+
+public:
+    /**
+     * @brief Constrói um radix heap vazio.
+     */
+    EscalonadorRadix();
+
+    /**
+     * @brief Destrói o radix heap, liberando a memória alocada.
+     */
+    ~EscalonadorRadix() override;
+
+    /**
+     * @brief Insere um novo evento na fila de prioridade.
+     * @param evento O evento a ser adicionado.
+     */
+    void insere_evento(const Evento& evento) override;
+
+    /**
+     * @brief Remove o evento com a menor chave de prioridade.
+     * @param evento Recebe uma cópia do próximo evento a ser processado.
+     * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
+     */
+    bool retira_proximo_evento(Evento& evento) override;
+
+    /**
+     * @brief Consulta, sem remover, a menor chave de prioridade pendente.
+     * @param chave Recebe a chave do próximo evento.
+     * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+     */
+    bool consulta_proxima_chave(long long& chave) const override;
+
+    /**
+     * @brief Verifica se a fila de eventos está vazia.
+     * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
+     */
+    bool vazio() const override;
+};
+
+#endif // ESCALONADOR_RADIX_HPP
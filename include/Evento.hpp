@@ -1,127 +1,147 @@
 #ifndef EVENTO_HPP
 #define EVENTO_HPP
 
-#include <string>
-#include <iomanip>
-#include <sstream>
-#include <iostream>
-
 /**
  * @enum TipoEvento
  * @brief Enumeração para os diferentes tipos de eventos na simulação.
  */
-enum class TipoEvento {
+enum class TipoEvento : unsigned char {
     CHEGADA_PACOTE,
-    TRANSPORTE_PACOTES
+    TRANSPORTE_PACOTES,
+    CICLO_TRANSPORTES
 };
 
 /**
- * @class Evento
- * @brief Classe base abstrata para todos os eventos na simulação.
+ * @struct Evento
+ * @brief Registro compacto de um evento da simulação.
+ *
+ * Em vez de uma hierarquia com métodos virtuais, cada evento é um registro de tamanho fixo
+ * identificado pelo seu tipo. Os dois IDs têm significado conforme o tipo:
+ * - `CHEGADA_PACOTE`: posição do pacote em `Simulacao::pacotes` e ID do armazém onde ele chega
+ *   (o ID do pacote entra apenas na chave de prioridade);
+ * - `TRANSPORTE_PACOTES`: ID do armazém de origem e ID do armazém de destino;
+ * - `CICLO_TRANSPORTES`: posição, em `Simulacao::rotas_transporte`, da próxima rota do ciclo
+ *   periódico (o segundo ID não é usado).
  *
- * Define a interface comum para eventos, incluindo tempo e tipo,
- * e um método virtual puro para obter uma chave de prioridade.
+ * A chave de prioridade é calculada uma única vez, na criação do evento, para que as
+ * comparações do escalonador sejam apenas leituras de um inteiro.
  */
-class Evento {
-public:
-    double tempo;       ///< O tempo de simulação em que o evento ocorre.
-    TipoEvento tipo;    ///< O tipo do evento.
+struct Evento {
+    static constexpr long long PESO_TEMPO = 10000000LL; ///< Peso do tempo na chave de prioridade (7 dígitos abaixo dele).
 
-    /**
-     * @brief Constrói um novo objeto Evento.
-     * @param tempo O tempo em que o evento ocorre.
-     * @param tipo O tipo do evento.
-     */
-    Evento(double tempo, TipoEvento tipo) : tempo(tempo), tipo(tipo) {}
-
-    /**
-     * @brief Destrutor virtual padrão.
-     */
-    virtual ~Evento() = default;
+    long long chave;    ///< Chave de prioridade pré-calculada (menor = processado antes).
+    int tempo;          ///< O tempo de simulação em que o evento ocorre.
+    TipoEvento tipo;    ///< O tipo do evento.
+    int id_primario;    ///< Posição do pacote (chegada), ID do armazém de origem (transporte) ou posição da rota (ciclo).
+    int id_secundario;  ///< ID do armazém de chegada (chegada) ou do armazém de destino (transporte).
 
     /**
-     * @brief Método virtual puro para obter a chave de prioridade do evento.
+     * @brief Gera a chave de prioridade de um evento de chegada.
      *
-     * A chave de prioridade é usada para ordenar eventos na fila de prioridade.
-     * Eventos com chaves menores têm prioridade mais alta.
-     * @return Uma chave de prioridade `long long`.
-     */
-    virtual long long obter_chave_prioridade() const = 0;
-};
-
-/**
- * @class EventoChegada
- * @brief Representa um evento de chegada de pacote em um armazém.
- */
-class EventoChegada : public Evento {
-public:
-    int id_pacote;      ///< O ID do pacote que está chegando.
-    int id_armazem;     ///< O ID do armazém onde o pacote está chegando.
-
-    /**
-     * @brief Constrói um novo objeto EventoChegada.
+     * Chave: Tempo (6) | ID Pacote (6) | Tipo (1) = 13 dígitos
      * @param tempo O tempo de chegada.
      * @param id_pacote O ID do pacote.
-     * @param id_armazem O ID do armazém.
+     * @return A chave de prioridade calculada.
      */
-    EventoChegada(double tempo, int id_pacote, int id_armazem)
-        : Evento(tempo, TipoEvento::CHEGADA_PACOTE), id_pacote(id_pacote), id_armazem(id_armazem) {}
+    static long long chave_chegada(int tempo, int id_pacote) {
+        return (long long)tempo * PESO_TEMPO + id_pacote * 10LL + 1;
+    }
 
     /**
-     * @brief Gera uma chave de prioridade para o evento de chegada.
+     * @brief Gera a chave de prioridade de um evento de transporte.
      *
-     * A chave é composta pelo tempo, ID do pacote e um tipo de desempate.
+     * Chave: Tempo (6) | Origem (3) | Destino (3) | Tipo (1) = 13 dígitos
+     * @param tempo O tempo do transporte.
+     * @param origem O ID do armazém de origem.
+     * @param destino O ID do armazém de destino.
      * @return A chave de prioridade calculada.
      */
-    long long obter_chave_prioridade() const override {
-        // Chave: Tempo (6) | ID Pacote (6) | Tipo (1) = 13 dígitos
-        long long chave = (long long)tempo * 10000000LL + id_pacote * 10LL + 1;
-        return chave;
+    static long long chave_transporte(int tempo, int origem, int destino) {
+        return (long long)tempo * PESO_TEMPO + origem * 10000LL + destino * 10LL + 2;
     }
-};
 
-/**
- * @class EventoTransporte
- * @brief Representa um evento de transporte de pacotes de um armazém para outro.
- */
-class EventoTransporte : public Evento {
-public:
-    int id_armazem_origem;    ///< O ID do armazém de origem.
-    int id_armazem_destino;   ///< O ID do armazém de destino.
+    /**
+     * @brief Cria um evento de chegada de pacote em um armazém.
+     * @param tempo O tempo de chegada.
+     * @param id_pacote O ID do pacote, usado no desempate da chave.
+     * @param posicao_pacote A posição do pacote em `Simulacao::pacotes`.
+     * @param id_armazem O ID do armazém.
+     * @return O evento criado.
+     */
+    static Evento chegada(int tempo, int id_pacote, int posicao_pacote, int id_armazem) {
+        Evento e;
+        e.chave = chave_chegada(tempo, id_pacote);
+        e.tempo = tempo;
+        e.tipo = TipoEvento::CHEGADA_PACOTE;
+        e.id_primario = posicao_pacote;
+        e.id_secundario = id_armazem;
+        return e;
+    }
 
     /**
-     * @brief Constrói um novo objeto EventoTransporte.
-     * @param tempo O tempo do evento de transporte.
+     * @brief Cria um evento de transporte de pacotes entre dois armazéns.
+     * @param tempo O tempo do transporte.
      * @param origem O ID do armazém de origem.
      * @param destino O ID do armazém de destino.
+     * @return O evento criado.
      */
-    EventoTransporte(double tempo, int origem, int destino)
-        : Evento(tempo, TipoEvento::TRANSPORTE_PACOTES), id_armazem_origem(origem), id_armazem_destino(destino) {}
+    static Evento transporte(int tempo, int origem, int destino) {
+        Evento e;
+        e.chave = chave_transporte(tempo, origem, destino);
+        e.tempo = tempo;
+        e.tipo = TipoEvento::TRANSPORTE_PACOTES;
+        e.id_primario = origem;
+        e.id_secundario = destino;
+        return e;
+    }
 
     /**
-     * @brief Gera uma chave de prioridade para o evento de transporte.
+     * @brief Cria o evento do ciclo periódico de transportes, posicionado em uma das rotas.
      *
-     * A chave é composta pelo tempo, IDs de origem e destino, e um tipo de desempate.
-     * @return A chave de prioridade calculada.
+     * A chave é a do transporte da rota nesse tempo, então o ciclo ocupa na fila o lugar que
+     * o evento de transporte individual da rota ocuparia.
+     * @param tempo O tempo do ciclo.
+     * @param indice_rota A posição da rota em `Simulacao::rotas_transporte`.
+     * @param origem O ID do armazém de origem da rota.
+     * @param destino O ID do armazém de destino da rota.
+     * @return O evento criado.
      */
-    long long obter_chave_prioridade() const override {
-        // Chave: Tempo (6) | Origem (3) | Destino (3) | Tipo (1) = 13 dígitos
-        long long chave = (long long)tempo * 10000000LL + id_armazem_origem * 10000LL + id_armazem_destino * 10LL + 2;
-        return chave;
+    static Evento ciclo_transportes(int tempo, int indice_rota, int origem, int destino) {
+        Evento e;
+        e.chave = chave_transporte(tempo, origem, destino);
+        e.tempo = tempo;
+        e.tipo = TipoEvento::CICLO_TRANSPORTES;
+        e.id_primario = indice_rota;
+        e.id_secundario = 0;
+        return e;
     }
+
+    /** @brief Retorna a chave de prioridade pré-calculada do evento. */
+    long long obter_chave_prioridade() const { return chave; }
+
+    /** @brief Posição, em `Simulacao::pacotes`, do pacote de um evento de chegada. */
+    int posicao_pacote() const { return id_primario; }
+    /** @brief ID do armazém de um evento de chegada. */
+    int id_armazem() const { return id_secundario; }
+    /** @brief ID do armazém de origem de um evento de transporte. */
+    int id_armazem_origem() const { return id_primario; }
+    /** @brief ID do armazém de destino de um evento de transporte. */
+    int id_armazem_destino() const { return id_secundario; }
+    /** @brief Posição da próxima rota de um evento do ciclo de transportes. */
+    int indice_rota() const { return id_primario; }
 };
 
 /**
  * @struct ComparadorEventos
  * @brief Functor de comparação para ordenar eventos em uma fila de prioridade.
  *
- * Compara dois ponteiros de Evento com base em suas chaves de prioridade.
+ * Compara dois eventos com base em suas chaves de prioridade.
  * Aquele com a menor chave de prioridade é considerado "maior" para
  * uso em uma fila de prioridade de mínimo (min-heap).
  */
 struct ComparadorEventos {
-    bool operator()(const Evento* a, const Evento* b) const {
-        return a->obter_chave_prioridade() > b->obter_chave_prioridade();
+    bool operator()(const Evento& a, const Evento& b) const {
+        return a.chave > b.chave;
     }
 };
 
@@ -3,36 +3,36 @@
 
 #include <stdexcept>
 
-/**
- * @struct NoFila
- * @brief Representa um nó em uma estrutura de dados de fila.
- * @tparam T O tipo de dado armazenado no nó.
- */
-template <typename T>
-struct NoFila {
-    T dado;             ///< O dado armazenado no nó.
-    NoFila* proximo;    ///< Ponteiro para o próximo nó na fila.
-};
-
 /**
  * @class Fila
  * @brief Implementa uma estrutura de dados de fila genérica (FIFO).
+ *
+ * Os elementos ficam em um buffer circular cuja capacidade é sempre uma potência de 2, de
+ * modo que a posição de cada elemento é obtida com uma máscara. O buffer só cresce (dobrando)
+ * quando enche; `limpar` mantém a capacidade, então uma fila reutilizada não aloca memória.
  * @tparam T O tipo de elementos a serem armazenados na fila.
  */
 template <typename T>
 class Fila {
 private:
-    NoFila<T>* frente;      ///< Ponteiro para o primeiro elemento da fila.
-    NoFila<T>* tras;        ///< Ponteiro para o último elemento da fila.
+    T* dados;               ///< Buffer circular com os elementos.
+    int capacidade;         ///< Número de posições de `dados` (0 ou potência de 2).
+    int frente;             ///< Posição do primeiro elemento da fila.
     int tamanho_atual;      ///< O número de elementos atualmente na fila.
 
+    /** @brief Realoca o buffer com `nova_capacidade` posições, desenrolando os elementos a partir da posição 0. */
+    void realocar(int nova_capacidade);
+
 public:
-    /** @brief Constrói uma nova fila vazia. */
+    /** @brief Constrói uma nova fila vazia, sem alocar memória. */
     Fila();
 
     /** @brief Destrói a fila, liberando todos os seus elementos. */
     ~Fila();
 
+    Fila(const Fila<T>&) = delete;
+    Fila<T>& operator=(const Fila<T>&) = delete;
+
     /**
      * @brief Adiciona um elemento ao final da fila.
      * @param elemento O elemento a ser adicionado.
@@ -57,21 +57,57 @@ public:
      * @return O tamanho da fila.
      */
     int tamanho() const;
+
+    /**
+     * @brief Garante espaço para pelo menos `nova_capacidade` elementos sem realocação.
+     * @param nova_capacidade A capacidade desejada.
+     */
+    void reservar(int nova_capacidade);
+
+    /** @brief Remove todos os elementos da fila, mantendo a capacidade alocada. */
+    void limpar();
 };
 
 /**
  * @brief Construtor da classe Fila. Inicializa uma fila vazia.
  */
 template <typename T>
-Fila<T>::Fila() : frente(nullptr), tras(nullptr), tamanho_atual(0) {}
+Fila<T>::Fila() : dados(nullptr), capacidade(0), frente(0), tamanho_atual(0) {}
 
 /**
- * @brief Destrutor da classe Fila. Libera toda a memória alocada para os nós da fila.
+ * @brief Destrutor da classe Fila. Libera o buffer de elementos.
  */
 template <typename T>
 Fila<T>::~Fila() {
-    while (!esta_vazia()) {
-        desenfileirar();
+    delete[] dados;
+}
+
+/**
+ * @brief Realoca o buffer, copiando os elementos na ordem da fila para o início do novo buffer.
+ * @param nova_capacidade O novo número de posições (potência de 2, não menor que o tamanho).
+ */
+template <typename T>
+void Fila<T>::realocar(int nova_capacidade) {
+    T* novos_dados = new T[nova_capacidade];
+    for (int i = 0; i < tamanho_atual; ++i) {
+        novos_dados[i] = dados[(frente + i) & (capacidade - 1)];
+    }
+    delete[] dados;
+    dados = novos_dados;
+    capacidade = nova_capacidade;
+    frente = 0;
+}
+
+/**
+ * @brief Garante espaço para pelo menos `nova_capacidade` elementos sem realocação.
+ * @param nova_capacidade A capacidade desejada (arredondada para a próxima potência de 2).
+ */
+template <typename T>
+void Fila<T>::reservar(int nova_capacidade) {
+    if (nova_capacidade > capacidade) {
+        int potencia = 4;
+        while (potencia < nova_capacidade) potencia *= 2;
+        realocar(potencia);
     }
 }
 
@@ -81,13 +117,10 @@ Fila<T>::~Fila() {
  */
 template <typename T>
 void Fila<T>::enfileirar(const T& elemento) {
-    NoFila<T>* novo_no = new NoFila<T>{elemento, nullptr};
-    if (esta_vazia()) {
-        frente = tras = novo_no;
-    } else {
-        tras->proximo = novo_no;
-        tras = novo_no;
+    if (tamanho_atual == capacidade) {
+        realocar(capacidade > 0 ? capacidade * 2 : 4);
     }
+    dados[(frente + tamanho_atual) & (capacidade - 1)] = elemento;
     tamanho_atual++;
 }
 
@@ -101,13 +134,8 @@ T Fila<T>::desenfileirar() {
     if (esta_vazia()) {
         throw std::out_of_range("A fila está vazia.");
     }
-    NoFila<T>* no_a_remover = frente;
-    T dado_removido = no_a_remover->dado;
-    frente = frente->proximo;
-    if (frente == nullptr) {
-        tras = nullptr;
-    }
-    delete no_a_remover;
+    T dado_removido = dados[frente];
+    frente = (frente + 1) & (capacidade - 1);
     tamanho_atual--;
     return dado_removido;
 }
@@ -118,7 +146,7 @@ T Fila<T>::desenfileirar() {
  */
 template <typename T>
 bool Fila<T>::esta_vazia() const {
-    return frente == nullptr;
+    return tamanho_atual == 0;
 }
 
 /**
@@ -130,4 +158,13 @@ int Fila<T>::tamanho() const {
     return tamanho_atual;
 }
 
+/**
+ * @brief Remove todos os elementos da fila, deixando-a vazia. A capacidade é mantida.
+ */
+template <typename T>
+void Fila<T>::limpar() {
+    frente = 0;
+    tamanho_atual = 0;
+}
+
 #endif // FILA_HPP
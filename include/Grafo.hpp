@@ -0,0 +1,119 @@
+#ifndef GRAFO_HPP
+#define GRAFO_HPP
+
+#include "VetorDinamico.hpp"
+
+/**
+ * @enum RepresentacaoGrafo
+ * @brief Formas de armazenar as arestas da rede de armazéns.
+ */
+enum class RepresentacaoGrafo {
+    AUTOMATICA, ///< Escolhe pela densidade da rede (padrão).
+    ESPARSA,    ///< Linhas esparsas comprimidas (CSR): 4 bytes por aresta.
+    DENSA       ///< Matriz de bits: 1 bit por par de armazéns.
+};
+
+/**
+ * @class Grafo
+ * @brief Representa a rede de armazéns, em formato esparso (CSR) ou como matriz de bits.
+ *
+ * No formato esparso, os vizinhos de cada armazém ficam contíguos em um único array, em ordem
+ * crescente de ID, e `inicio[v] .. inicio[v + 1]` delimita a lista do armazém `v`; a memória
+ * cresce com o número de arestas. No formato denso, cada linha da matriz de adjacência ocupa
+ * `ceil(V / 64)` palavras de 64 bits, e o BFS expande a fronteira com operações AND sobre
+ * palavras inteiras. A escolha automática usa a matriz de bits quando ela ocupa menos memória
+ * que o CSR, isto é, quando mais de 1/32 dos pares de armazéns estão ligados.
+ */
+class Grafo {
+private:
+    int num_vertices;           ///< Número de armazéns (vértices) da rede.
+    int num_arestas;            ///< Número de arestas dirigidas (sem repetições).
+    int* inicio;                ///< CSR: início da lista de vizinhos de cada vértice (nullptr no formato denso).
+    int* vizinhos;              ///< CSR: listas de vizinhos concatenadas (nullptr no formato denso).
+    unsigned long long* bits;   ///< Matriz de bits, linha a linha (nullptr no formato esparso).
+    int palavras_por_linha;     ///< Número de palavras de 64 bits em cada linha de `bits`.
+
+    /** @brief Libera as representações alocadas. */
+    void liberar();
+    /** @brief Converte o CSR já montado em matriz de bits e descarta o CSR. */
+    void compactar_em_bits();
+    /** @brief BFS sobre o CSR, com fila de vértices. */
+    void bfs_esparso(int origem, int* antecessor) const;
+    /** @brief BFS sobre a matriz de bits, com expansão da fronteira palavra a palavra. */
+    void bfs_denso(int origem, int* antecessor) const;
+
+public:
+    /** @brief Constrói um grafo vazio. */
+    Grafo();
+
+    /** @brief Destrói o grafo, liberando os arrays alocados. */
+    ~Grafo();
+
+    Grafo(const Grafo&) = delete;
+    Grafo& operator=(const Grafo&) = delete;
+
+    /**
+     * @brief Monta o grafo a partir de uma lista de arestas dirigidas.
+     *
+     * As arestas podem vir em qualquer ordem; arestas repetidas são descartadas.
+     * @param num_vertices O número de vértices.
+     * @param origens Vértice de origem de cada aresta.
+     * @param destinos Vértice de destino de cada aresta (mesmo tamanho de `origens`).
+     * @param representacao Formato interno; por padrão, escolhido pela densidade.
+     */
+    void construir(int num_vertices, const VetorDinamico<int>& origens, const VetorDinamico<int>& destinos,
+                   RepresentacaoGrafo representacao = RepresentacaoGrafo::AUTOMATICA);
+
+    /** @brief Retorna o número de vértices. */
+    int obter_num_vertices() const { return num_vertices; }
+
+    /** @brief Retorna o número de arestas dirigidas armazenadas. */
+    int obter_num_arestas() const { return num_arestas; }
+
+    /** @brief Indica se o grafo está armazenado como matriz de bits. */
+    bool denso() const { return bits != nullptr; }
+
+    /**
+     * @brief Indica se existe a aresta dirigida `u -> v`.
+     * @param u O vértice de origem.
+     * @param v O vértice de destino.
+     * @return Verdadeiro se a aresta existe.
+     */
+    bool tem_aresta(int u, int v) const;
+
+    /**
+     * @brief Chama `funcao(vizinho)` para cada vizinho de `v`, em ordem crescente de ID.
+     * @param v O vértice.
+     * @param funcao Função (ou lambda) que recebe o ID de cada vizinho.
+     */
+    template <typename Funcao>
+    void para_cada_vizinho(int v, Funcao funcao) const {
+        if (bits) {
+            const unsigned long long* linha = bits + (long long)v * palavras_por_linha;
+            for (int w = 0; w < palavras_por_linha; ++w) {
+                unsigned long long palavra = linha[w];
+                while (palavra) {
+                    funcao(w * 64 + __builtin_ctzll(palavra));
+                    palavra &= palavra - 1;
+                }
+            }
+        } else {
+            for (int i = inicio[v]; i < inicio[v + 1]; ++i) {
+                funcao(vizinhos[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Calcula a árvore de antecessores de um BFS a partir de `origem`.
+     *
+     * Os vizinhos são visitados em ordem crescente de ID nas duas representações, então
+     * a árvore é a mesma independentemente do formato interno.
+     * @param origem O vértice de partida.
+     * @param antecessor Array com `num_vertices` posições que recebe o antecessor de cada
+     *        vértice (-1 para a origem e para vértices inalcançáveis).
+     */
+    void calcular_arvore_bfs(int origem, int* antecessor) const;
+};
+
+#endif // GRAFO_HPP
@@ -0,0 +1,85 @@
+#ifndef LEITOR_ENTRADA_HPP
+#define LEITOR_ENTRADA_HPP
+
+#include <climits>
+#include <cstddef>
+#include <string>
+
+/**
+ * @class LeitorEntrada
+ * @brief Leitor do arquivo de entrada da simulação, com o arquivo mapeado em memória.
+ *
+ * O arquivo inteiro é mapeado com `mmap` e percorrido por ponteiro: inteiros são convertidos
+ * à mão, sem `std::istream` nem locale, e as palavras fixas do formato (como "pac", "org" e
+ * "dst") são apenas conferidas e puladas, sem criar `std::string`. Se o arquivo não puder ser
+ * mapeado (por exemplo, um pipe), ele é lido inteiro para um buffer.
+ *
+ * Qualquer entrada malformada lança `std::runtime_error` com a linha, a coluna, o campo
+ * esperado e o trecho encontrado.
+ */
+class LeitorEntrada {
+private:
+    const char* inicio;         ///< Início do conteúdo do arquivo.
+    const char* atual;          ///< Posição de leitura.
+    const char* fim;            ///< Fim do conteúdo do arquivo.
+    std::size_t tamanho_mapa;   ///< Tamanho da região mapeada (0 se o conteúdo não foi mapeado).
+    std::size_t liberado;       ///< Bytes do início do mapa já devolvidos ao sistema por `liberar_lidos`.
+    char* copia;                ///< Conteúdo lido para a memória, quando não foi possível mapear.
+
+    /** @brief Avança a posição de leitura até o próximo caractere que não seja espaço. */
+    void pular_espacos();
+
+    /**
+     * @brief Lança um erro indicando a posição de `token`, o que se esperava e o que foi encontrado.
+     * @param token Início do trecho inválido.
+     * @param esperado Descrição do que se esperava nessa posição.
+     */
+    [[noreturn]] void falhar(const char* token, const std::string& esperado) const;
+
+public:
+    /**
+     * @brief Abre e mapeia o arquivo de entrada.
+     * @param nome_arquivo Caminho do arquivo.
+     * @throws std::runtime_error Se o arquivo não puder ser aberto ou lido.
+     */
+    explicit LeitorEntrada(const std::string& nome_arquivo);
+
+    /** @brief Desfaz o mapeamento (ou libera a cópia) do arquivo. */
+    ~LeitorEntrada();
+
+    LeitorEntrada(const LeitorEntrada&) = delete;
+    LeitorEntrada& operator=(const LeitorEntrada&) = delete;
+
+    /**
+     * @brief Lê o próximo inteiro decimal (com sinal opcional).
+     * @param campo Nome do campo, usado na mensagem de erro.
+     * @param minimo Menor valor aceito.
+     * @param maximo Maior valor aceito.
+     * @return O inteiro lido.
+     * @throws std::runtime_error Se o próximo token não for um inteiro ou estiver fora de [minimo, maximo].
+     */
+    int ler_inteiro(const char* campo, long long minimo = INT_MIN, long long maximo = INT_MAX);
+
+    /**
+     * @brief Confere e pula uma palavra fixa do formato.
+     * @param palavra A palavra esperada.
+     * @throws std::runtime_error Se o próximo token não for exatamente `palavra`.
+     */
+    void esperar_palavra(const char* palavra);
+
+    /**
+     * @brief Verifica, sem consumir nada, se o próximo token começa com uma letra.
+     * @return Verdadeiro se o próximo token é uma palavra.
+     */
+    bool proximo_e_palavra();
+
+    /**
+     * @brief Devolve ao sistema as páginas do mapa que já foram lidas.
+     *
+     * Usado na leitura incremental de arquivos grandes, para que a memória residente não
+     * cresça com o trecho já consumido. Não tem efeito se o conteúdo foi copiado.
+     */
+    void liberar_lidos();
+};
+
+#endif // LEITOR_ENTRADA_HPP
@@ -1,7 +1,7 @@
 #ifndef PACOTE_HPP
 #define PACOTE_HPP
 
-#include "VetorDinamico.hpp"
+class TabelaRotas;
 
 /**
  * @enum EstadoPacote
@@ -20,7 +20,7 @@ enum class EstadoPacote {
  * @brief Representa um pacote no sistema de logística.
  *
  * Contém informações sobre o pacote, como ID, origem, destino, rota e estado atual,
- * além de estatísticas de tempo para análise de desempenho.
+ * além do início do seu armazenamento atual, usado nas métricas da simulação.
  */
 class Pacote {
 public:
@@ -30,13 +30,11 @@ public:
     int armazem_origem;             ///< O armazém de origem do pacote.
     int armazem_destino;            ///< O armazém de destino final do pacote.
     EstadoPacote estado_atual;      ///< O estado atual do pacote no processo de entrega.
-    VetorDinamico<int> rota;        ///< A sequência de armazéns que o pacote deve visitar.
-    int proximo_armazem_index;      ///< Índice do próximo armazém na rota.
-    bool first_time = true;
+    int proximo_salto;              ///< Posição do próximo armazém da rota no array de saltos de `TabelaRotas`.
+    int posicao;                    ///< Posição do pacote em `Simulacao::pacotes`, referenciada pelos eventos de chegada.
 
-    // Estatísticas
-    double tempo_total_armazenado;      ///< Tempo total que o pacote passou armazenado.
-    double tempo_total_em_transporte;   ///< Tempo total que o pacote passou em transporte.
+    // Estatísticas (os totais ficam em `MetricasSimulacao`)
+    int inicio_armazenamento;           ///< Tempo do último armazenamento do pacote.
 
     /**
      * @brief Constrói um novo objeto Pacote.
@@ -48,21 +46,26 @@ public:
     Pacote(int id, int tempo_postagem, int origem, int destino);
 
     /**
-     * @brief Define a rota para o pacote.
-     * @param nova_rota A rota a ser seguida pelo pacote.
+     * @brief Define a rota do pacote.
+     *
+     * O pacote guarda apenas a posição do próximo salto; a rota fica em `TabelaRotas`,
+     * compartilhada por todos os pacotes com a mesma origem e o mesmo destino.
+     * @param inicio_rota A posição do primeiro salto da rota (a origem).
      */
-    void definir_rota(const VetorDinamico<int>& nova_rota);
+    void definir_rota(int inicio_rota);
 
     /**
      * @brief Obtém o próximo armazém de destino na rota do pacote.
+     * @param rotas A tabela que guarda a rota do pacote.
      * @return O ID do próximo armazém, ou -1 se a rota estiver completa.
      */
-    int obter_proximo_destino();
+    int obter_proximo_destino(const TabelaRotas& rotas) const;
 
     /**
      * @brief Avança o pacote para o próximo armazém em sua rota.
+     * @param rotas A tabela que guarda a rota do pacote.
      */
-    void avancar_rota();
+    void avancar_rota(const TabelaRotas& rotas);
 
     /**
      * @brief Atualiza o estado atual do pacote.
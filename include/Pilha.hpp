@@ -3,27 +3,25 @@
 
 #include <stdexcept>
 
-/**
- * @struct NoPilha
- * @brief Representa um nó em uma estrutura de dados de pilha.
- * @tparam T O tipo de dado armazenado no nó.
- */
-template <typename T>
-struct NoPilha {
-    T dado;             ///< O dado armazenado no nó.
-    NoPilha* proximo;    ///< Ponteiro para o próximo nó na pilha.
-};
-
 /**
  * @class Pilha
  * @brief Implementa uma estrutura de dados de pilha genérica (LIFO).
+ *
+ * Os elementos ficam contíguos em um array que dobra de capacidade quando enche, então
+ * empilhar e desempilhar não alocam memória por elemento. A capacidade só é alocada no
+ * primeiro `empilha` (ou `reservar`), de forma que pilhas que nunca recebem elementos
+ * não ocupam memória além do próprio objeto.
  * @tparam T O tipo de elementos a serem armazenados na pilha.
  */
 template <typename T>
 class Pilha {
 private:
-    NoPilha<T>* topo;   ///< Ponteiro para o elemento no topo da pilha.
+    T* dados;           ///< Array com os elementos; a base da pilha fica na posição 0.
     int tamanho;        ///< O número de elementos atualmente na pilha.
+    int capacidade;     ///< O número de posições alocadas em `dados`.
+
+    /** @brief Realoca o array com exatamente `nova_capacidade` posições. */
+    void realocar(int nova_capacidade);
 
 public:
     /** @brief Constrói uma nova pilha vazia. */
@@ -58,6 +56,42 @@ public:
      */
     T desempilha();
 
+    /**
+     * @brief Empilha `quantidade` elementos de uma só vez, na ordem do array.
+     *
+     * Equivale a chamar `empilha(origem[i])` para i = 0, 1, ..., com no máximo uma realocação.
+     * @param origem Os elementos a empilhar; `origem[quantidade - 1]` fica no topo.
+     * @param quantidade O número de elementos.
+     */
+    void empilha_varios(const T* origem, int quantidade);
+
+    /**
+     * @brief Desempilha até `quantidade` elementos de uma só vez.
+     *
+     * Equivale a chamar `desempilha()` repetidamente: `destino[0]` recebe o antigo topo.
+     * @param destino Array que recebe os elementos removidos.
+     * @param quantidade O número máximo de elementos a remover.
+     * @return O número de elementos removidos (menor que `quantidade` se a pilha esvaziar).
+     */
+    int desempilha_varios(T* destino, int quantidade);
+
+    /**
+     * @brief Acessa um elemento pela posição a partir da base, sem removê-lo.
+     *
+     * Permite percorrer a pilha sem desempilhar: a posição 0 é o elemento mais antigo e
+     * `obter_tamanho() - 1` é o topo.
+     * @param indice A posição a partir da base.
+     * @return Uma referência constante ao elemento.
+     * @throws std::out_of_range se a posição for inválida.
+     */
+    const T& elemento_da_base(int indice) const;
+
+    /**
+     * @brief Remove os `quantidade` elementos mais antigos (da base), mantendo a ordem dos demais.
+     * @param quantidade O número de elementos a remover (limitado ao tamanho da pilha).
+     */
+    void remover_da_base(int quantidade);
+
     /**
      * @brief Retorna o elemento no topo da pilha sem removê-lo (peek).
      * @return O elemento do topo.
@@ -77,33 +111,92 @@ public:
      */
     int obter_tamanho() const;
 
-    /** @brief Remove todos os elementos da pilha. */
+    /**
+     * @brief Garante espaço para pelo menos `nova_capacidade` elementos sem realocação.
+     * @param nova_capacidade A capacidade desejada.
+     */
+    void reservar(int nova_capacidade);
+
+    /** @brief Remove todos os elementos da pilha, mantendo a capacidade alocada. */
     void limpar();
 };
 
 /**
- * @brief Construtor da classe Pilha. Inicializa uma pilha vazia.
+ * @brief Construtor da classe Pilha. Inicializa uma pilha vazia, sem alocar memória.
  */
 template <typename T>
-Pilha<T>::Pilha() : topo(nullptr), tamanho(0) {}
+Pilha<T>::Pilha() : dados(nullptr), tamanho(0), capacidade(0) {}
 
 /**
- * @brief Destrutor da classe Pilha. Libera toda a memória alocada para os nós da pilha.
+ * @brief Destrutor da classe Pilha. Libera o array de elementos.
  */
 template <typename T>
 Pilha<T>::~Pilha() {
-    limpar();
+    delete[] dados;
+}
+
+/**
+ * @brief Construtor de cópia. Copia os elementos de outra pilha, mantendo a ordem.
+ * @param outro A pilha a ser copiada.
+ */
+template <typename T>
+Pilha<T>::Pilha(const Pilha<T>& outro) : dados(nullptr), tamanho(0), capacidade(0) {
+    empilha_varios(outro.dados, outro.tamanho);
+}
+
+/**
+ * @brief Operador de atribuição de cópia.
+ * @param outro A pilha a ser copiada.
+ * @return Uma referência para esta pilha após a cópia.
+ */
+template <typename T>
+Pilha<T>& Pilha<T>::operator=(const Pilha<T>& outro) {
+    if (this != &outro) {
+        limpar();
+        empilha_varios(outro.dados, outro.tamanho);
+    }
+    return *this;
+}
+
+/**
+ * @brief Realoca o array de elementos, copiando os elementos atuais.
+ * @param nova_capacidade O novo número de posições (não menor que `tamanho`).
+ */
+template <typename T>
+void Pilha<T>::realocar(int nova_capacidade) {
+    T* novos_dados = new T[nova_capacidade];
+    for (int i = 0; i < tamanho; ++i) {
+        novos_dados[i] = dados[i];
+    }
+    delete[] dados;
+    dados = novos_dados;
+    capacidade = nova_capacidade;
+}
+
+/**
+ * @brief Garante espaço para pelo menos `nova_capacidade` elementos sem realocação.
+ * @param nova_capacidade A capacidade desejada.
+ */
+template <typename T>
+void Pilha<T>::reservar(int nova_capacidade) {
+    if (nova_capacidade > capacidade) {
+        realocar(nova_capacidade);
+    }
 }
 
 /**
  * @brief Adiciona um elemento ao topo da pilha (empilha).
+ *
+ * Quando o array está cheio, a capacidade dobra (começando em 4), o que dá custo
+ * amortizado constante.
  * @param elemento O elemento a ser adicionado à pilha.
  */
 template <typename T>
 void Pilha<T>::empilha(T elemento) {
-    NoPilha<T>* novo_no = new NoPilha<T>{elemento, topo};
-    topo = novo_no;
-    tamanho++;
+    if (tamanho == capacidade) {
+        realocar(capacidade > 0 ? capacidade * 2 : 4);
+    }
+    dados[tamanho++] = elemento;
 }
 
 /**
@@ -116,12 +209,67 @@ T Pilha<T>::desempilha() {
     if (esta_vazia()) {
         throw std::out_of_range("A pilha está vazia.");
     }
-    NoPilha<T>* no_a_remover = topo;
-    T dado_removido = no_a_remover->dado;
-    topo = topo->proximo;
-    delete no_a_remover;
-    tamanho--;
-    return dado_removido;
+    return dados[--tamanho];
+}
+
+/**
+ * @brief Empilha `quantidade` elementos de uma só vez, na ordem do array.
+ * @param origem Os elementos a empilhar; `origem[quantidade - 1]` fica no topo.
+ * @param quantidade O número de elementos.
+ */
+template <typename T>
+void Pilha<T>::empilha_varios(const T* origem, int quantidade) {
+    if (tamanho + quantidade > capacidade) {
+        int nova_capacidade = capacidade > 0 ? capacidade : 4;
+        while (nova_capacidade < tamanho + quantidade) nova_capacidade *= 2;
+        realocar(nova_capacidade);
+    }
+    for (int i = 0; i < quantidade; ++i) {
+        dados[tamanho++] = origem[i];
+    }
+}
+
+/**
+ * @brief Desempilha até `quantidade` elementos de uma só vez.
+ * @param destino Array que recebe os elementos removidos; `destino[0]` recebe o antigo topo.
+ * @param quantidade O número máximo de elementos a remover.
+ * @return O número de elementos removidos.
+ */
+template <typename T>
+int Pilha<T>::desempilha_varios(T* destino, int quantidade) {
+    if (quantidade > tamanho) quantidade = tamanho;
+    for (int i = 0; i < quantidade; ++i) {
+        destino[i] = dados[--tamanho];
+    }
+    return quantidade;
+}
+
+/**
+ * @brief Acessa um elemento pela posição a partir da base (0 é o elemento mais antigo).
+ * @param indice A posição a partir da base.
+ * @return Uma referência constante ao elemento.
+ * @throws std::out_of_range se a posição for inválida.
+ */
+template <typename T>
+const T& Pilha<T>::elemento_da_base(int indice) const {
+    if (indice < 0 || indice >= tamanho) {
+        throw std::out_of_range("Posição fora da pilha.");
+    }
+    return dados[indice];
+}
+
+/**
+ * @brief Remove os `quantidade` elementos da base, deslocando os demais para o início do array.
+ * @param quantidade O número de elementos a remover (limitado ao tamanho da pilha).
+ */
+template <typename T>
+void Pilha<T>::remover_da_base(int quantidade) {
+    if (quantidade <= 0) return;
+    if (quantidade > tamanho) quantidade = tamanho;
+    for (int i = quantidade; i < tamanho; ++i) {
+        dados[i - quantidade] = dados[i];
+    }
+    tamanho -= quantidade;
 }
 
 /**
@@ -134,7 +282,7 @@ T Pilha<T>::ver_topo() const {
     if (esta_vazia()) {
         throw std::out_of_range("A pilha está vazia.");
     }
-    return topo->dado;
+    return dados[tamanho - 1];
 }
 
 /**
@@ -143,7 +291,7 @@ T Pilha<T>::ver_topo() const {
  */
 template <typename T>
 bool Pilha<T>::esta_vazia() const {
-    return topo == nullptr;
+    return tamanho == 0;
 }
 
 /**
@@ -156,13 +304,11 @@ int Pilha<T>::obter_tamanho() const {
 }
 
 /**
- * @brief Remove todos os elementos da pilha, deixando-a vazia.
+ * @brief Remove todos os elementos da pilha, deixando-a vazia. A capacidade é mantida.
  */
 template <typename T>
 void Pilha<T>::limpar() {
-    while (!esta_vazia()) {
-        desempilha();
-    }
+    tamanho = 0;
 }
 
 #endif // PILHA_HPP
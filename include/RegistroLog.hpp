@@ -0,0 +1,114 @@
+#ifndef REGISTRO_LOG_HPP
+#define REGISTRO_LOG_HPP
+
+#include <string>
+#include "SaidaLog.hpp"
+
+/**
+ * @enum FormatoLog
+ * @brief Formatos de saída do log da simulação.
+ */
+enum class FormatoLog {
+    TEXTO,          ///< Linhas de texto legíveis (padrão).
+    BINARIO,        ///< Registros binários de tamanho fixo, com tempo absoluto.
+    BINARIO_DELTA,  ///< Registros binários de tamanho fixo, com tempo em delta.
+    RESUMO          ///< Nenhum registro por evento; apenas as métricas agregadas ao final.
+};
+
+/**
+ * @brief Converte o nome de um formato de log ("texto", "binario", "binario-delta" ou "resumo") no tipo correspondente.
+ * @param nome O nome do formato.
+ * @return O formato correspondente.
+ * @throws std::invalid_argument Se o nome não corresponder a nenhum formato.
+ */
+FormatoLog formato_log_por_nome(const std::string& nome);
+
+/**
+ * @enum OperacaoLog
+ * @brief Operações registradas no log da simulação.
+ */
+enum class OperacaoLog : unsigned char {
+    ENTREGUE,       ///< "pacote PPP entregue em AAA"
+    ARMAZENADO,     ///< "pacote PPP armazenado em AAA na secao SSS"
+    REMOVIDO,       ///< "pacote PPP removido de AAA na secao SSS"
+    EM_TRANSITO,    ///< "pacote PPP em transito de AAA para SSS"
+    REARMAZENADO    ///< "pacote PPP rearmazenado em AAA na secao SSS"
+};
+
+/**
+ * @brief Escreve um registro no formato de texto do log.
+ *
+ * Formato: `TTTTTTT pacote PPP <ação> AAA[ <complemento> SSS]`, com o tempo em 7 dígitos e os
+ * IDs em 3, completados com zeros. As linhas são separadas por '\n', sem quebra após a última.
+ * @param saida O escritor de destino.
+ * @param tempo O tempo do registro.
+ * @param pacote O ID de exibição do pacote.
+ * @param operacao A operação registrada.
+ * @param armazem O armazém da operação.
+ * @param secao A seção (ou o armazém de destino, em `EM_TRANSITO`); ignorada em `ENTREGUE`.
+ */
+void escrever_registro_texto(SaidaLog& saida, int tempo, int pacote, OperacaoLog operacao, int armazem, int secao);
+
+/**
+ * @class CodificadorLogBinario
+ * @brief Escreve o log em formato binário compacto, com registros de tamanho fixo.
+ *
+ * O arquivo começa com um cabeçalho de 8 bytes: a assinatura "TP2L", a versão e um byte de
+ * opções (bit 0: tempos em delta; bit 1: IDs de armazém largos). Cada registro tem, em
+ * little-endian:
+ * - tempo: int32 absoluto ou, no modo delta, int16 com a diferença para o registro anterior;
+ * - operação: uint8 (`OperacaoLog`);
+ * - pacote: int8 (o ID de exibição, sempre entre -99 e 99);
+ * - armazém e seção: int16 cada, ou int32 cada com IDs largos.
+ *
+ * No modo delta, uma diferença que não cabe em int16 é precedida por um registro de escape
+ * (operação 0xFF, delta 0) que traz o tempo absoluto nos 4 bytes seguintes.
+ */
+class CodificadorLogBinario {
+private:
+    SaidaLog& saida;    ///< Escritor de destino.
+    bool delta;         ///< Tempos codificados como diferença para o registro anterior.
+    bool ids_largos;    ///< Armazém e seção com 32 bits em vez de 16.
+    int ultimo_tempo;   ///< Tempo do registro anterior (modo delta).
+
+public:
+    /**
+     * @brief Constrói o codificador e escreve o cabeçalho.
+     * @param saida O escritor de destino.
+     * @param delta Se os tempos devem ser codificados em delta.
+     * @param ids_largos Se armazém e seção usam 32 bits (necessário acima de 32767 armazéns).
+     */
+    CodificadorLogBinario(SaidaLog& saida, bool delta, bool ids_largos);
+
+    /**
+     * @brief Escreve um registro.
+     * @param tempo O tempo do registro.
+     * @param pacote O ID de exibição do pacote.
+     * @param operacao A operação registrada.
+     * @param armazem O armazém da operação.
+     * @param secao A seção (ou o armazém de destino, em `EM_TRANSITO`).
+     */
+    void registrar(int tempo, int pacote, OperacaoLog operacao, int armazem, int secao);
+
+    /**
+     * @brief Tamanho de um registro, em bytes.
+     * @param delta Se os tempos estão em delta.
+     * @param ids_largos Se armazém e seção usam 32 bits.
+     */
+    static int tamanho_registro(bool delta, bool ids_largos) {
+        return (delta ? 2 : 4) + 2 + (ids_largos ? 8 : 4);
+    }
+};
+
+/**
+ * @brief Converte um log binário de volta para o formato de texto.
+ *
+ * Lê o log do descritor em blocos e escreve exatamente os bytes que a simulação teria
+ * escrito no modo texto.
+ * @param descritor_entrada Descritor de onde o log binário é lido.
+ * @param saida O escritor de destino do texto.
+ * @throws std::runtime_error Se o cabeçalho for inválido, o log estiver truncado ou a leitura falhar.
+ */
+void decodificar_log_binario(int descritor_entrada, SaidaLog& saida);
+
+#endif // REGISTRO_LOG_HPP
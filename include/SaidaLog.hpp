@@ -0,0 +1,87 @@
+#ifndef SAIDA_LOG_HPP
+#define SAIDA_LOG_HPP
+
+/**
+ * @class SaidaLog
+ * @brief Escritor bufferizado para o log da simulação.
+ *
+ * As linhas são montadas diretamente em um buffer grande, com inteiros formatados à mão
+ * (largura fixa, completados com zeros), e o buffer só é enviado ao descritor de arquivo
+ * com `write` quando enche ou em `descarregar`. Não há uma descarga por linha.
+ *
+ * As linhas são separadas por '\n', mas a última não recebe quebra: a quebra é escrita ao
+ * iniciar cada linha a partir da segunda.
+ */
+class SaidaLog {
+private:
+    int descritor;      ///< Descritor de arquivo de destino (1 = saída padrão).
+    char* buffer;       ///< Buffer de escrita.
+    int capacidade;     ///< Tamanho do buffer, em bytes.
+    int ocupado;        ///< Bytes do buffer ainda não enviados.
+    bool linha_aberta;  ///< Indica se alguma linha já foi iniciada.
+
+    /** @brief Envia bytes ao descritor, repetindo escritas parciais. */
+    void enviar(const char* dados, int tamanho);
+
+    /** @brief Garante `bytes` livres no buffer, descarregando-o se necessário. */
+    void garantir_espaco(int bytes) {
+        if (ocupado + bytes > capacidade) descarregar();
+    }
+
+public:
+    /**
+     * @brief Constrói o escritor.
+     * @param descritor Descritor de arquivo de destino (padrão: saída padrão).
+     * @param capacidade Tamanho do buffer, em bytes (padrão: 1 MiB).
+     */
+    explicit SaidaLog(int descritor = 1, int capacidade = 1 << 20);
+
+    /** @brief Descarrega o que restar no buffer e o libera. */
+    ~SaidaLog();
+
+    SaidaLog(const SaidaLog&) = delete;
+    SaidaLog& operator=(const SaidaLog&) = delete;
+
+    /** @brief Inicia uma nova linha, separando-a da anterior com '\n'. */
+    void iniciar_linha() {
+        if (linha_aberta) escrever_caractere('\n');
+        linha_aberta = true;
+    }
+
+    /**
+     * @brief Escreve um caractere.
+     * @param c O caractere.
+     */
+    void escrever_caractere(char c) {
+        garantir_espaco(1);
+        buffer[ocupado++] = c;
+    }
+
+    /**
+     * @brief Escreve uma sequência de bytes.
+     * @param dados Os bytes a escrever.
+     * @param tamanho O número de bytes.
+     */
+    void escrever(const char* dados, int tamanho);
+
+    /**
+     * @brief Escreve um texto terminado em '\0'.
+     * @param texto O texto a escrever.
+     */
+    void escrever_texto(const char* texto);
+
+    /**
+     * @brief Escreve um inteiro em decimal, completado com zeros à esquerda até `largura` caracteres.
+     *
+     * Reproduz `std::setw(largura) << std::setfill('0')`: números mais largos são escritos
+     * por inteiro, e em negativos os zeros ficam antes do sinal (por exemplo, "0-5").
+     * @param valor O inteiro.
+     * @param largura A largura mínima do campo.
+     */
+    void escrever_inteiro(long long valor, int largura);
+
+    /** @brief Envia ao descritor todo o conteúdo do buffer. */
+    void descarregar();
+};
+
+#endif // SAIDA_LOG_HPP
@@ -7,20 +7,87 @@
 #include "Pacote.hpp"
 #include "Escalonador.hpp"
 #include "VetorDinamico.hpp"
+#include "Pilha.hpp"
+#include "Grafo.hpp"
+#include "TabelaRotas.hpp"
+#include "LeitorEntrada.hpp"
+#include "SaidaLog.hpp"
+#include "RegistroLog.hpp"
+
+/**
+ * @struct OpcoesSimulacao
+ * @brief Opções de execução da simulação, normalmente definidas pela linha de comando.
+ */
+struct OpcoesSimulacao {
+    TipoEscalonador escalonador = TipoEscalonador::HEAP; ///< Implementação da fila de eventos.
+    int num_threads = 1; ///< Threads usadas no cálculo das rotas (0 = todos os núcleos).
+    FormatoLog formato_log = FormatoLog::TEXTO; ///< Formato do log escrito na saída padrão.
+    ModoTransporte modo_transporte = ModoTransporte::PERIODICO; ///< Agendamento dos eventos de transporte das rotas.
+    int janela_pacotes = -1; ///< Antecedência, em unidades de tempo, da leitura incremental dos pacotes (negativa = todos lidos no início).
+};
+
+/**
+ * @struct MetricasSimulacao
+ * @brief Métricas agregadas da simulação, mantidas por contadores durante a execução.
+ *
+ * As contagens correspondem às linhas do log de texto de cada operação, então podem ser
+ * obtidas sem formatar nem imprimir o log.
+ */
+struct MetricasSimulacao {
+    int makespan = 0;                   ///< Tempo da última entrega.
+    long long entregas = 0;             ///< Registros "entregue".
+    long long armazenamentos = 0;       ///< Registros "armazenado".
+    long long remocoes = 0;             ///< Registros "removido".
+    long long transportes = 0;          ///< Registros "em transito".
+    long long rearmazenamentos = 0;     ///< Registros "rearmazenado".
+    double tempo_total_armazenado = 0;  ///< Soma dos períodos entre cada armazenamento e a partida do pacote em transporte.
+    int num_pacotes = 0;                ///< Número de pacotes da simulação.
+
+    /** @brief Tempo médio que cada pacote passou armazenado (0 se não houver pacotes). */
+    double tempo_medio_armazenado() const {
+        return num_pacotes > 0 ? tempo_total_armazenado / num_pacotes : 0.0;
+    }
+};
+
+/**
+ * @struct RotaTransporte
+ * @brief Rota percorrida pelo ciclo periódico de transportes.
+ */
+struct RotaTransporte {
+    long long chave;        ///< Parte da chave de transporte que não depende do tempo (`Evento::chave_transporte(0, origem, destino)`).
+    int origem;             ///< ID do armazém de origem.
+    int destino;            ///< ID do armazém de destino.
+    Pilha<Pacote*>* secao;  ///< Seção da origem com os pacotes para o destino.
+};
 
 /**
  * @brief Orquestra a simulação de logística, gerenciando o tempo, eventos e estado do sistema.
  */
 class Simulacao {
 private:
+    OpcoesSimulacao opcoes; ///< Opções de execução recebidas na construção.
     double tempo_atual; ///< Relógio da simulação, avança a cada evento.
     Transporte* transporte_config; ///< Configurações globais de transporte (capacidade, latência, etc.).
     int num_armazens; ///< Número total de armazéns na simulação.
     VetorDinamico<Armazem*> armazens; ///< Vetor dinâmico com ponteiros para todos os armazéns.
-    VetorDinamico<Pacote*> pacotes; ///< Vetor dinâmico com ponteiros para todos os pacotes da simulação.
-    bool** matriz_adjacencia; ///< Matriz que representa as rotas de transporte entre os armazéns.
-    Escalonador* escalonador; ///< Fila de prioridade (min-heap) que gerencia os eventos futuros.
-    std::string last_line_buffer; ///< Buffer para a última linha de log para evitar nova linha no final.
+    VetorDinamico<Pacote*> pacotes; ///< Pacotes agendados e ainda não entregues, cada um na sua `posicao` (nullptr nas posições livres).
+    Pilha<int> posicoes_livres; ///< Posições de `pacotes` liberadas por entregas, reaproveitadas pelos próximos pacotes.
+    int pacotes_pendentes; ///< Quantidade de pacotes ainda não entregues.
+    LeitorEntrada* leitor_pacotes; ///< Leitor dos pacotes ainda não lidos (nullptr depois do último).
+    int pacotes_nao_lidos; ///< Pacotes que ainda faltam ler do arquivo.
+    VetorDinamico<Pacote*> pacotes_carregados; ///< Sem janela: todos os pacotes, lidos no início e em ordem de postagem.
+    int proximo_carregado; ///< Próxima posição de `pacotes_carregados` a agendar.
+    Pacote* pacote_adiado; ///< Próximo pacote em ordem de postagem, já lido mas ainda não agendado.
+    int ultimo_tempo_lido; ///< Tempo de postagem do último pacote lido incrementalmente.
+    int horizonte_leitura; ///< Todos os pacotes postados até este tempo já foram agendados.
+    long long chave_maxima_processada; ///< Maior chave de evento já retirada e processada (sob demanda, limita a grade).
+    Grafo grafo; ///< Rotas de transporte entre os armazéns (CSR ou matriz de bits).
+    VetorDinamico<RotaTransporte> rotas_transporte; ///< Rotas do ciclo periódico, em ordem de chave de transporte.
+    TabelaRotas rotas; ///< Rotas dos pares (origem, destino) já usados, compartilhadas entre os pacotes.
+    Escalonador* escalonador; ///< Fila de prioridade que gerencia os eventos futuros.
+    SaidaLog saida; ///< Escritor bufferizado do log (saída padrão).
+    CodificadorLogBinario* codificador_binario; ///< Codificador do log binário (nullptr no formato texto).
+    MetricasSimulacao metricas; ///< Contadores agregados, atualizados a cada registro.
 
     int tempo_inicial;
     bool first_time = true;
@@ -30,30 +97,81 @@ private:
      */
     void carregar_dados(const std::string& nome_arquivo);
 
+    /**
+     * @brief Lê o próximo pacote do arquivo.
+     * @return O pacote lido, ou nullptr se todos já foram lidos.
+     */
+    Pacote* ler_pacote();
+
+    /**
+     * @brief Retorna o próximo pacote em ordem de postagem, lendo-o do arquivo se preciso.
+     * @return O pacote, ou nullptr se não houver mais pacotes.
+     */
+    Pacote* proximo_pacote();
+
+    /**
+     * @brief Agenda a chegada de todos os pacotes postados até `tempo_limite`.
+     * @param tempo_limite Maior tempo de postagem a agendar.
+     * @param lote Recebe os eventos de chegada criados.
+     */
+    void admitir_pacotes(long long tempo_limite, VetorDinamico<Evento>& lote);
+
+    /**
+     * @brief Remove um pacote entregue de `pacotes` e libera sua memória.
+     * @param pacote O pacote entregue.
+     */
+    void liberar_pacote(Pacote* pacote);
+
     /**
      * @brief Cria e agenda os primeiros eventos (chegada de pacotes e transportes).
      */
     void agendar_eventos_iniciais();
 
     /**
-     * @brief Calcula a rota mais curta entre dois armazéns usando BFS.
-     * @param origem ID do armazém de origem.
-     * @param destino ID do armazém de destino.
-     * @return VetorDinamico<int> contendo a sequência de IDs de armazéns da rota.
+     * @brief Calcula, possivelmente em paralelo, as rotas de um lote de pacotes.
+     * @param novos Os pacotes que ainda não têm rota.
      */
-    VetorDinamico<int> calcular_rota_bfs(int origem, int destino);
+    void precalcular_rotas(const VetorDinamico<Pacote*>& novos);
 
     /**
      * @brief Processa um evento de chegada de pacote a um armazém.
-     * @param evento Ponteiro para o evento de chegada.
+     * @param evento O evento de chegada.
      */
-    void processar_evento_chegada(EventoChegada* evento);
+    void processar_evento_chegada(const Evento& evento);
+
+    /**
+     * @brief Agenda, no modo sob demanda, o transporte de uma rota que acaba de receber um pacote.
+     * @param origem ID do armazém de origem da rota.
+     * @param destino ID do armazém de destino da rota.
+     * @param chave_limite Maior chave já retirada do escalonador (incluindo a do evento atual).
+     */
+    void agendar_transporte_sob_demanda(int origem, int destino, long long chave_limite);
 
     /**
      * @brief Processa um evento de transporte de pacotes entre armazéns.
-     * @param evento Ponteiro para o evento de transporte.
+     * @param evento O evento de transporte.
      */
-    void processar_evento_transporte(EventoTransporte* evento);
+    void processar_evento_transporte(const Evento& evento);
+
+    /**
+     * @brief Monta `rotas_transporte`, com todas as rotas que têm transporte, em ordem de chave.
+     */
+    void montar_rotas_transporte();
+
+    /**
+     * @brief Processa o ciclo periódico de transportes, a partir da rota indicada no evento.
+     * @param evento O evento do ciclo.
+     */
+    void processar_ciclo_transportes(const Evento& evento);
+
+    /**
+     * @brief Remove os pacotes de uma seção, despacha os mais antigos e rearmazena os demais.
+     * @param tempo O tempo do transporte.
+     * @param origem ID do armazém de origem.
+     * @param destino ID do armazém de destino.
+     * @param secao A seção da origem com os pacotes para o destino.
+     */
+    void transportar_pacotes(int tempo, int origem, int destino, Pilha<Pacote*>& secao);
 
     /**
      * @brief Libera toda a memória alocada dinamicamente durante a simulação.
@@ -63,21 +181,32 @@ private:
     /**
      * @brief Verifica se todos os pacotes já foram entregues.
      * @return True se todos os pacotes foram entregues, False caso contrário.
+     * @note Consulta o contador de pendentes, em O(1).
      */
     bool todos_pacotes_entregues() const;
 
     /**
-     * @brief Imprime uma linha de log, gerenciando o buffer para a última linha.
-     * @param line A linha a ser impressa.
+     * @brief Escreve as métricas agregadas em uma única linha (formato `resumo`).
+     */
+    void escrever_resumo();
+
+    /**
+     * @brief Registra uma operação no log, em texto ou em binário conforme as opções.
+     * @param tempo O tempo do registro.
+     * @param pacote O pacote registrado.
+     * @param operacao A operação registrada.
+     * @param armazem O armazém da operação.
+     * @param secao A seção (ou o armazém de destino, em trânsito); ignorada em `ENTREGUE`.
      */
-    void print_log_line(const std::string& line);
+    void registrar_log(int tempo, const Pacote* pacote, OperacaoLog operacao, int armazem, int secao = 0);
 
 public:
     /**
      * @brief Construtor da classe Simulacao.
      * @param nome_arquivo Caminho para o arquivo de configuração inicial.
+     * @param opcoes Opções de execução (por exemplo, a implementação do escalonador).
      */
-    Simulacao(const std::string& nome_arquivo);
+    Simulacao(const std::string& nome_arquivo, const OpcoesSimulacao& opcoes = OpcoesSimulacao());
 
     /**
      * @brief Destrutor da classe Simulacao, responsável por chamar a limpeza de memória.
@@ -88,6 +217,18 @@ public:
      * @brief Inicia e executa o loop principal da simulação até que não hajam mais eventos.
      */
     void executar();
+
+    /**
+     * @brief Retorna quantos pacotes ainda não foram entregues.
+     * @return O número de pacotes pendentes, útil para relatar o progresso de execuções longas.
+     */
+    int obter_pacotes_pendentes() const;
+
+    /**
+     * @brief Retorna as métricas agregadas da simulação.
+     * @return Contagens de cada operação, makespan e tempo de armazenamento acumulados até agora.
+     */
+    const MetricasSimulacao& obter_metricas() const { return metricas; }
 };
 
 #endif // SIMULACAO_HPP
@@ -0,0 +1,91 @@
+#ifndef TABELA_ROTAS_HPP
+#define TABELA_ROTAS_HPP
+
+#include "VetorDinamico.hpp"
+
+/**
+ * @class TabelaRotas
+ * @brief Guarda as rotas dos pares (origem, destino) já usados, compartilhadas entre os pacotes.
+ *
+ * Os armazéns de todas as rotas ficam contíguos em um único array de saltos, cada rota seguida
+ * de um marcador de fim; um pacote percorre a sua rota guardando apenas a posição do próximo
+ * salto. Os saltos ocupam 16 bits quando há até 65535 armazéns, e 32 bits caso contrário. Uma
+ * tabela de espalhamento (sondagem linear) leva o par à posição do seu primeiro salto, então a
+ * memória cresce com os pares usados e o comprimento das suas rotas, e não com o quadrado do
+ * número de armazéns.
+ */
+class TabelaRotas {
+private:
+    bool saltos_curtos;                     ///< Indica se os saltos ficam em `saltos16`.
+    VetorDinamico<unsigned short> saltos16; ///< Saltos de todas as rotas, com 16 bits (fim = 0xFFFF).
+    VetorDinamico<int> saltos32;            ///< Saltos de todas as rotas, com 32 bits (fim = -1).
+    VetorDinamico<long long> pares;         ///< Código `origem * num_armazens + destino` de cada rota.
+    VetorDinamico<int> inicio_rota;         ///< Posição do primeiro salto de cada rota.
+    int num_armazens;                       ///< Número de armazéns da rede.
+    int* tabela_pares;                      ///< Tabela de espalhamento: índice da rota em `pares` ou -1.
+    int mascara_tabela;                     ///< Tamanho da tabela menos 1 (o tamanho é potência de 2).
+
+    /** @brief Retorna a posição de `codigo` na tabela: a sua entrada ou a vaga onde entraria. */
+    int sondar(long long codigo) const;
+
+    /** @brief Dobra a tabela de espalhamento e reinsere as rotas existentes. */
+    void crescer_tabela();
+
+public:
+    /** @brief Posição de uma rota vazia, sem nenhum salto, usada até o pacote receber a sua. */
+    static const int ROTA_VAZIA = 0;
+
+    /** @brief Constrói uma tabela vazia, para uma rede sem armazéns. */
+    TabelaRotas();
+
+    /** @brief Destrói a tabela, liberando a tabela de espalhamento. */
+    ~TabelaRotas();
+
+    TabelaRotas(const TabelaRotas&) = delete;
+    TabelaRotas& operator=(const TabelaRotas&) = delete;
+
+    /**
+     * @brief Descarta as rotas existentes e prepara a tabela para uma rede de `num_armazens`.
+     * @param num_armazens O número de armazéns; define a largura dos saltos.
+     */
+    void configurar(int num_armazens);
+
+    /**
+     * @brief Procura a rota de um par.
+     * @param origem O ID do armazém de origem.
+     * @param destino O ID do armazém de destino.
+     * @return A posição do primeiro salto da rota, ou -1 se o par ainda não tiver rota.
+     */
+    int procurar(int origem, int destino) const;
+
+    /**
+     * @brief Acrescenta a rota de um par que ainda não tem rota.
+     * @param origem O ID do armazém de origem.
+     * @param destino O ID do armazém de destino.
+     * @param caminho Os armazéns da rota, da origem ao destino.
+     * @param comprimento O número de armazéns em `caminho`.
+     * @return A posição do primeiro salto da rota.
+     */
+    int adicionar(int origem, int destino, const int* caminho, int comprimento);
+
+    /**
+     * @brief Retorna o armazém em uma posição do array de saltos.
+     * @param posicao Uma posição dentro de uma rota ou no seu marcador de fim.
+     * @return O ID do armazém, ou -1 no fim da rota.
+     */
+    int salto(int posicao) const {
+        if (saltos_curtos) {
+            unsigned short armazem = saltos16.sem_verificacao(posicao);
+            return armazem == 0xFFFF ? -1 : armazem;
+        }
+        return saltos32.sem_verificacao(posicao);
+    }
+
+    /** @brief Retorna o número de rotas guardadas. */
+    int num_rotas() const { return pares.tamanho(); }
+
+    /** @brief Retorna o total de posições do array de saltos, incluindo os marcadores de fim. */
+    int num_saltos() const { return saltos_curtos ? saltos16.tamanho() : saltos32.tamanho(); }
+};
+
+#endif // TABELA_ROTAS_HPP
@@ -1,6 +1,25 @@
 #ifndef TRANSPORTE_HPP
 #define TRANSPORTE_HPP
 
+#include <string>
+
+/**
+ * @enum ModoTransporte
+ * @brief Formas de agendar os eventos de transporte das rotas.
+ */
+enum class ModoTransporte {
+    PERIODICO,   ///< Um evento por rota a cada intervalo, mesmo com a seção vazia (padrão).
+    SOB_DEMANDA  ///< Rotas sem pacotes ficam sem eventos até que um pacote chegue à seção.
+};
+
+/**
+ * @brief Converte o nome de um modo de transporte ("periodico" ou "sob-demanda") no tipo correspondente.
+ * @param nome O nome do modo.
+ * @return O modo correspondente.
+ * @throws std::invalid_argument Se o nome não corresponder a nenhum modo.
+ */
+ModoTransporte modo_transporte_por_nome(const std::string& nome);
+
 /**
  * @class Transporte
  * @brief Armazena as configurações globais para os eventos de transporte na simulação.
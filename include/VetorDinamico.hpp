@@ -1,11 +1,19 @@
 #ifndef VETOR_DINAMICO_HPP
 #define VETOR_DINAMICO_HPP
 
+#include <algorithm>  // Para std::sort
+#include <functional> // Para std::less
 #include <stdexcept>
+#include <type_traits> // Para std::is_signed
+#include <utility>    // Para std::move
 
 /**
  * @class VetorDinamico
  * @brief Implementa um vetor dinâmico genérico (array redimensionável).
+ *
+ * `operator[]` verifica os limites e lança exceção, para depuração e uso geral. Laços
+ * internos que já garantem os limites podem usar `sem_verificacao` ou percorrer o vetor
+ * por `begin()`/`end()` (ponteiros), sem o custo da verificação.
  * @tparam T O tipo de elementos a serem armazenados no vetor.
  */
 template <typename T>
@@ -18,11 +26,14 @@ private:
     /**
      * @brief Dobra a capacidade do vetor quando ele está cheio.
      * 
-     * Aloca um novo array com o dobro da capacidade, copia os elementos existentes
+     * Aloca um novo array com o dobro da capacidade, move os elementos existentes
      * e libera a memória do array antigo.
      */
     void redimensionar();
 
+    /** @brief Realoca o array com exatamente `nova_capacidade` posições, movendo os elementos. */
+    void realocar(int nova_capacidade);
+
 public:
     /**
      * @brief Constrói um novo vetor dinâmico.
@@ -48,6 +59,19 @@ public:
      */
     VetorDinamico& operator=(const VetorDinamico& outro);
 
+    /**
+     * @brief Construtor de movimento. Toma o array de `outro`, que fica vazio.
+     * @param outro O vetor a ser movido.
+     */
+    VetorDinamico(VetorDinamico&& outro) noexcept;
+
+    /**
+     * @brief Operador de atribuição de movimento. Troca os arrays com `outro`.
+     * @param outro O vetor a ser movido.
+     * @return Uma referência para este vetor.
+     */
+    VetorDinamico& operator=(VetorDinamico&& outro) noexcept;
+
     /**
      * @brief Adiciona um elemento ao final do vetor.
      * @param elemento O elemento a ser adicionado.
@@ -76,6 +100,29 @@ public:
      */
     const T& operator[](int indice) const;
 
+    /**
+     * @brief Acessa um elemento sem verificar os limites.
+     * @param indice O índice do elemento (deve estar em `[0, tamanho())`).
+     * @return Uma referência ao elemento.
+     */
+    T& sem_verificacao(int indice) { return dados[indice]; }
+
+    /**
+     * @brief Acessa um elemento constante sem verificar os limites.
+     * @param indice O índice do elemento (deve estar em `[0, tamanho())`).
+     * @return Uma referência constante ao elemento.
+     */
+    const T& sem_verificacao(int indice) const { return dados[indice]; }
+
+    /** @brief Ponteiro para o primeiro elemento. */
+    T* begin() { return dados; }
+    /** @brief Ponteiro para a posição após o último elemento. */
+    T* end() { return dados + tamanho_atual; }
+    /** @brief Ponteiro constante para o primeiro elemento. */
+    const T* begin() const { return dados; }
+    /** @brief Ponteiro constante para a posição após o último elemento. */
+    const T* end() const { return dados + tamanho_atual; }
+
     /**
      * @brief Retorna o número de elementos no vetor.
      * @return O tamanho do vetor.
@@ -83,14 +130,56 @@ public:
     int tamanho() const;
 
     /**
-     * @brief Remove todos os elementos do vetor e o redefine para seu estado inicial.
+     * @brief Retorna o número de elementos que cabem no vetor sem realocação.
+     * @return A capacidade do vetor.
+     */
+    int obter_capacidade() const { return capacidade; }
+
+    /**
+     * @brief Garante espaço para pelo menos `nova_capacidade` elementos sem realocação.
+     * @param nova_capacidade A capacidade desejada.
+     */
+    void reservar(int nova_capacidade);
+
+    /**
+     * @brief Altera o número de elementos do vetor.
+     *
+     * Se o vetor crescer, as novas posições recebem `valor`; se diminuir, apenas o tamanho é
+     * reduzido, como em `limpar`: as posições excedentes mantêm seus valores até serem reusadas.
+     * @param novo_tamanho O novo número de elementos.
+     * @param valor O valor das posições acrescentadas.
+     */
+    void ajustar_tamanho(int novo_tamanho, const T& valor = T());
+
+    /**
+     * @brief Remove todos os elementos do vetor, mantendo a capacidade alocada.
      */
     void limpar();
 
     /**
-     * @brief Ordena o vetor por ID usando o algoritmo de insertion sort.
+     * @brief Ordena o vetor de ponteiros pelo membro `id` dos objetos apontados.
+     *
+     * A ordenação é estável, feita por `ordenar_por_chave`.
      */
     void ordenar_por_id();
+
+    /**
+     * @brief Ordena o vetor com um comparador (introsort, O(n log n), não estável).
+     * @param menor Função que retorna `true` se o primeiro elemento deve vir antes do segundo.
+     */
+    template <typename Comparador = std::less<T>>
+    void ordenar(Comparador menor = Comparador());
+
+    /**
+     * @brief Ordena o vetor por uma chave inteira (radix sort LSD, O(n), estável).
+     *
+     * A chave de cada elemento é calculada uma única vez. Só são feitas passagens para os
+     * bytes em que as chaves diferem, então chaves pequenas (IDs, tempos) custam poucas
+     * passagens sobre o vetor.
+     * @param chave Função que recebe um elemento e retorna a sua chave inteira (com ou sem sinal, até 64 bits).
+     */
+    template <typename FuncaoChave>
+    void ordenar_por_chave(FuncaoChave chave);
 };
 
 /**
@@ -144,17 +233,78 @@ VetorDinamico<T>& VetorDinamico<T>::operator=(const VetorDinamico& outro) {
 }
 
 /**
- * @brief Redimensiona o vetor, dobrando sua capacidade.
+ * @brief Construtor de movimento para a classe VetorDinamico.
+ * @param outro O VetorDinamico cujo array é transferido; ele fica vazio, sem array alocado.
  */
 template <typename T>
-void VetorDinamico<T>::redimensionar() {
-    capacidade = (capacidade == 0) ? 1 : capacidade * 2;
-    T* novos_dados = new T[capacidade];
+VetorDinamico<T>::VetorDinamico(VetorDinamico&& outro) noexcept
+    : dados(outro.dados), capacidade(outro.capacidade), tamanho_atual(outro.tamanho_atual) {
+    outro.dados = nullptr;
+    outro.capacidade = 0;
+    outro.tamanho_atual = 0;
+}
+
+/**
+ * @brief Operador de atribuição de movimento.
+ *
+ * Troca os arrays dos dois vetores; o array antigo deste vetor é liberado pelo destrutor de `outro`.
+ * @param outro O VetorDinamico a ser movido para este.
+ * @return Uma referência a este objeto.
+ */
+template <typename T>
+VetorDinamico<T>& VetorDinamico<T>::operator=(VetorDinamico&& outro) noexcept {
+    std::swap(dados, outro.dados);
+    std::swap(capacidade, outro.capacidade);
+    std::swap(tamanho_atual, outro.tamanho_atual);
+    return *this;
+}
+
+/**
+ * @brief Realoca o array com exatamente `nova_capacidade` posições.
+ * @param nova_capacidade O novo número de posições (não menor que o tamanho atual).
+ */
+template <typename T>
+void VetorDinamico<T>::realocar(int nova_capacidade) {
+    T* novos_dados = new T[nova_capacidade];
     for (int i = 0; i < tamanho_atual; ++i) {
-        novos_dados[i] = dados[i];
+        novos_dados[i] = std::move(dados[i]);
     }
     delete[] dados;
     dados = novos_dados;
+    capacidade = nova_capacidade;
+}
+
+/**
+ * @brief Redimensiona o vetor, dobrando sua capacidade.
+ */
+template <typename T>
+void VetorDinamico<T>::redimensionar() {
+    realocar((capacidade == 0) ? 1 : capacidade * 2);
+}
+
+/**
+ * @brief Garante espaço para pelo menos `nova_capacidade` elementos sem realocação.
+ * @param nova_capacidade A capacidade desejada.
+ */
+template <typename T>
+void VetorDinamico<T>::reservar(int nova_capacidade) {
+    if (nova_capacidade > capacidade) {
+        realocar(nova_capacidade);
+    }
+}
+
+/**
+ * @brief Altera o número de elementos do vetor, preenchendo as novas posições com `valor`.
+ * @param novo_tamanho O novo número de elementos.
+ * @param valor O valor das posições acrescentadas.
+ */
+template <typename T>
+void VetorDinamico<T>::ajustar_tamanho(int novo_tamanho, const T& valor) {
+    reservar(novo_tamanho);
+    for (int i = tamanho_atual; i < novo_tamanho; ++i) {
+        dados[i] = valor;
+    }
+    tamanho_atual = novo_tamanho;
 }
 
 /**
@@ -166,7 +316,7 @@ void VetorDinamico<T>::adicionar(T elemento) {
     if (tamanho_atual == capacidade) {
         redimensionar();
     }
-    dados[tamanho_atual++] = elemento;
+    dados[tamanho_atual++] = std::move(elemento);
 }
 
 /**
@@ -207,30 +357,100 @@ int VetorDinamico<T>::tamanho() const {
 }
 
 /**
- * @brief Limpa o vetor, removendo todos os elementos e redefinindo a capacidade.
+ * @brief Limpa o vetor, removendo todos os elementos. A capacidade é mantida.
  */
 template <typename T>
 void VetorDinamico<T>::limpar() {
-    delete[] dados;
-    capacidade = 10;
     tamanho_atual = 0;
-    dados = new T[capacidade];
 }
 
 /**
- * @brief Ordena o vetor de ponteiros para objetos que possuem um membro 'display_id'.
+ * @brief Ordena o vetor de ponteiros pelo membro `id` dos objetos apontados, de forma estável.
  */
 template <typename T>
 void VetorDinamico<T>::ordenar_por_id() {
-    for (int i = 1; i < tamanho_atual; i++) {
-        T chave = dados[i];
-        int j = i - 1;
-        while (j >= 0 && dados[j]->id > chave->id) {
-            dados[j + 1] = dados[j];
-            j = j - 1;
+    ordenar_por_chave([](const T& elemento) { return elemento->id; });
+}
+
+/**
+ * @brief Ordena o vetor com um comparador, usando o introsort de `std::sort`.
+ * @param menor Função que retorna `true` se o primeiro elemento deve vir antes do segundo.
+ */
+template <typename T>
+template <typename Comparador>
+void VetorDinamico<T>::ordenar(Comparador menor) {
+    std::sort(dados, dados + tamanho_atual, menor);
+}
+
+/**
+ * @brief Ordena o vetor por uma chave inteira com radix sort LSD de 8 bits por passagem.
+ *
+ * As chaves são convertidas para 64 bits sem sinal; nas chaves com sinal, o bit de sinal é
+ * invertido, o que preserva a ordem das chaves negativas. Cada passagem distribui os elementos (e as chaves)
+ * de forma estável em um array auxiliar; os arrays são trocados ao fim de cada passagem.
+ * Vetores pequenos usam insertion sort, que também é estável.
+ * @param chave Função que recebe um elemento e retorna a sua chave inteira.
+ */
+template <typename T>
+template <typename FuncaoChave>
+void VetorDinamico<T>::ordenar_por_chave(FuncaoChave chave) {
+    const int n = tamanho_atual;
+    if (n < 2) return;
+
+    typedef typename std::decay<decltype(chave(dados[0]))>::type TipoChave;
+    const unsigned long long bit_sinal = std::is_signed<TipoChave>::value ? (1ULL << 63) : 0;
+
+    unsigned long long* chaves = new unsigned long long[n];
+    unsigned long long todas_or = 0, todas_and = ~0ULL;
+    for (int i = 0; i < n; ++i) {
+        chaves[i] = (unsigned long long)(long long)chave(dados[i]) ^ bit_sinal;
+        todas_or |= chaves[i];
+        todas_and &= chaves[i];
+    }
+    unsigned long long bits_variaveis = todas_or ^ todas_and;
+
+    if (n <= 32) {
+        for (int i = 1; i < n; ++i) {
+            T elemento = std::move(dados[i]);
+            unsigned long long c = chaves[i];
+            int j = i - 1;
+            while (j >= 0 && chaves[j] > c) {
+                dados[j + 1] = std::move(dados[j]);
+                chaves[j + 1] = chaves[j];
+                --j;
+            }
+            dados[j + 1] = std::move(elemento);
+            chaves[j + 1] = c;
+        }
+        delete[] chaves;
+        return;
+    }
+
+    T* auxiliar = nullptr;
+    unsigned long long* chaves_auxiliares = nullptr;
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += 8) {
+        if (((bits_variaveis >> deslocamento) & 0xFF) == 0) continue; // Byte igual em todas as chaves.
+        if (!auxiliar) {
+            auxiliar = new T[capacidade];
+            chaves_auxiliares = new unsigned long long[n];
+        }
+
+        int contagem[257] = {0};
+        for (int i = 0; i < n; ++i) {
+            contagem[((chaves[i] >> deslocamento) & 0xFF) + 1]++;
+        }
+        for (int b = 0; b < 256; ++b) contagem[b + 1] += contagem[b];
+        for (int i = 0; i < n; ++i) {
+            int destino = contagem[(chaves[i] >> deslocamento) & 0xFF]++;
+            auxiliar[destino] = std::move(dados[i]);
+            chaves_auxiliares[destino] = chaves[i];
         }
-        dados[j + 1] = chave;
+        std::swap(dados, auxiliar);
+        std::swap(chaves, chaves_auxiliares);
     }
+    delete[] auxiliar;
+    delete[] chaves_auxiliares;
+    delete[] chaves;
 }
 
 /**
@@ -244,9 +464,9 @@ void VetorDinamico<T>::push_front(T elemento) {
         redimensionar();
     }
     for (int i = tamanho_atual; i > 0; --i) {
-        dados[i] = dados[i - 1];
+        dados[i] = std::move(dados[i - 1]);
     }
-    dados[0] = elemento;
+    dados[0] = std::move(elemento);
     tamanho_atual++;
 }
 
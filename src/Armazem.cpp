@@ -1,13 +1,40 @@
 #include "../include/Armazem.hpp"
 
+/**
+ * @brief Espalha um ID de armazém (hash multiplicativo de Fibonacci).
+ */
+static inline unsigned int espalhar(int id_vizinho) {
+    return (unsigned int)id_vizinho * 2654435761u;
+}
+
 /**
  * @brief Constrói um novo objeto Armazem.
  *
+ * A tabela de espalhamento tem pelo menos o dobro de posições que o número de vizinhos,
+ * o que mantém as sondagens curtas.
  * @param id O identificador para o armazém.
- * @param total_armazens O número total de armazéns na simulação, usado para alocar as seções.
+ * @param vizinhos IDs dos armazéns vizinhos; cada um recebe uma seção (repetições são ignoradas).
+ * @param num_vizinhos O número de posições em `vizinhos`.
  */
-Armazem::Armazem(int id, int total_armazens) : id(id), num_secoes(total_armazens) {
-    secoes = new Pilha<Pacote*>[total_armazens];
+Armazem::Armazem(int id, const int* vizinhos, int num_vizinhos) : id(id), num_secoes(0) {
+    int tamanho_tabela = 2;
+    while (tamanho_tabela < 2 * num_vizinhos) tamanho_tabela <<= 1;
+    mascara_tabela = tamanho_tabela - 1;
+    tabela_secoes = new int[tamanho_tabela];
+    for (int i = 0; i < tamanho_tabela; ++i) tabela_secoes[i] = -1;
+
+    vizinho_da_secao = new int[num_vizinhos > 0 ? num_vizinhos : 1];
+    for (int i = 0; i < num_vizinhos; ++i) {
+        unsigned int posicao = espalhar(vizinhos[i]) & mascara_tabela;
+        while (tabela_secoes[posicao] != -1 && vizinho_da_secao[tabela_secoes[posicao]] != vizinhos[i]) {
+            posicao = (posicao + 1) & mascara_tabela;
+        }
+        if (tabela_secoes[posicao] == -1) {
+            tabela_secoes[posicao] = num_secoes;
+            vizinho_da_secao[num_secoes++] = vizinhos[i];
+        }
+    }
+    secoes = new Pilha<Pacote*>[num_secoes > 0 ? num_secoes : 1];
 }
 
 /**
@@ -15,20 +42,47 @@ Armazem::Armazem(int id, int total_armazens) : id(id), num_secoes(total_armazens
  */
 Armazem::~Armazem() {
     delete[] secoes;
+    delete[] vizinho_da_secao;
+    delete[] tabela_secoes;
+}
+
+/**
+ * @brief Procura a seção de um armazém vizinho.
+ * @param id_vizinho O ID do armazém vizinho.
+ * @return O índice da seção, ou -1 se o armazém não for vizinho.
+ */
+int Armazem::indice_secao(int id_vizinho) const {
+    unsigned int posicao = espalhar(id_vizinho) & mascara_tabela;
+    while (tabela_secoes[posicao] != -1) {
+        if (vizinho_da_secao[tabela_secoes[posicao]] == id_vizinho) {
+            return tabela_secoes[posicao];
+        }
+        posicao = (posicao + 1) & mascara_tabela;
+    }
+    return -1;
 }
 
 /**
  * @brief Adiciona um pacote à seção de armazenamento apropriada.
  *
- * O pacote é colocado na pilha correspondente ao seu próximo destino na rota.
+ * O pacote é colocado na pilha correspondente ao seu próximo destino na rota. Se o
+ * próximo destino não for vizinho (destino inalcançável), nenhum transporte o levaria
+ * adiante: o pacote é marcado como armazenado, mas não ocupa nenhuma seção.
  * @param pacote O pacote a ser armazenado.
+ * @param proximo_destino O próximo armazém da rota do pacote (-1 se a rota estiver completa).
+ * @return Verdadeiro se o pacote foi empilhado em uma seção que estava vazia.
  */
-void Armazem::armazenar_pacote(Pacote* pacote) {
-    int proximo_destino = pacote->obter_proximo_destino();
-    if (proximo_destino != -1 && proximo_destino < num_secoes) {
-        secoes[proximo_destino].empilha(pacote);
+bool Armazem::armazenar_pacote(Pacote* pacote, int proximo_destino) {
+    bool secao_estava_vazia = false;
+    if (proximo_destino != -1) {
+        int indice = indice_secao(proximo_destino);
+        if (indice != -1) {
+            secao_estava_vazia = secoes[indice].esta_vazia();
+            secoes[indice].empilha(pacote);
+        }
         pacote->atualizar_estado(EstadoPacote::ARMAZENADO);
     }
+    return secao_estava_vazia;
 }
 
 /**
@@ -36,11 +90,12 @@ void Armazem::armazenar_pacote(Pacote* pacote) {
  *
  * @param id_armazem_destino O ID do armazém de destino.
  * @return Uma referência para a pilha de pacotes da seção solicitada.
- * @throws std::out_of_range Se o ID do armazém de destino for inválido.
+ * @throws std::out_of_range Se o armazém de destino não for vizinho deste armazém.
  */
 Pilha<Pacote*>& Armazem::obter_secao(int id_armazem_destino) {
-    if (id_armazem_destino >= 0 && id_armazem_destino < num_secoes) {
-        return secoes[id_armazem_destino];
+    int indice = indice_secao(id_armazem_destino);
+    if (indice != -1) {
+        return secoes[indice];
     }
     throw std::out_of_range("ID de armazém de destino inválido.");
 }
@@ -0,0 +1,259 @@
+#include "../include/EscalonadorCalendario.hpp"
+
+/**
+ * @brief Constrói uma fila de calendário vazia.
+ * @param num_baldes_inicial A quantidade inicial de baldes (arredondada para potência de 2).
+ * @param largura_inicial A largura inicial de cada janela de tempo.
+ */
+EscalonadorCalendario::EscalonadorCalendario(int num_baldes_inicial, int largura_inicial)
+    : num_baldes(MIN_BALDES), largura((largura_inicial < 1 ? 1 : largura_inicial) * Evento::PESO_TEMPO),
+      janela_atual(0), tamanho(0), balde_minimo(-1), janela_minimo(0) {
+    while (num_baldes < num_baldes_inicial) num_baldes *= 2;
+    baldes = new Balde[num_baldes];
+    for (int i = 0; i < num_baldes; ++i) {
+        baldes[i].eventos = nullptr;
+        baldes[i].inicio = baldes[i].fim = baldes[i].capacidade = 0;
+    }
+}
+
+/**
+ * @brief Destrói a fila de calendário, liberando os baldes e seus eventos.
+ */
+EscalonadorCalendario::~EscalonadorCalendario() {
+    for (int i = 0; i < num_baldes; ++i) {
+        delete[] baldes[i].eventos;
+    }
+    delete[] baldes;
+}
+
+/**
+ * @brief Insere um evento em um balde, mantendo a ordenação por chave.
+ *
+ * O caso comum (chave maior que todas do balde) é um acréscimo no final; uma chave
+ * menor que todas reaproveita o espaço antes de `inicio`, se houver.
+ * @param balde O balde de destino.
+ * @param evento O evento a ser inserido.
+ */
+void EscalonadorCalendario::inserir_no_balde(Balde& balde, const Evento& evento) {
+    // Busca binária pela primeira posição com chave maior que a do evento.
+    int esq = balde.inicio, dir = balde.fim;
+    while (esq < dir) {
+        int meio = esq + (dir - esq) / 2;
+        if (balde.eventos[meio].chave <= evento.chave) esq = meio + 1;
+        else dir = meio;
+    }
+
+    if (esq == balde.inicio && balde.inicio > 0) {
+        balde.eventos[--balde.inicio] = evento;
+        return;
+    }
+
+    if (balde.fim == balde.capacidade) {
+        int ocupados = balde.fim - balde.inicio;
+        int nova_capacidade = (ocupados + 1 > balde.capacidade / 2) ? balde.capacidade * 2 : balde.capacidade;
+        if (nova_capacidade < 4) nova_capacidade = 4;
+        Evento* novos = (nova_capacidade == balde.capacidade) ? balde.eventos : new Evento[nova_capacidade];
+        // Compacta os eventos para o início do array (possivelmente o mesmo).
+        for (int i = 0; i < ocupados; ++i) {
+            novos[i] = balde.eventos[balde.inicio + i];
+        }
+        if (novos != balde.eventos) delete[] balde.eventos;
+        esq -= balde.inicio;
+        balde.eventos = novos;
+        balde.capacidade = nova_capacidade;
+        balde.inicio = 0;
+        balde.fim = ocupados;
+    }
+
+    for (int i = balde.fim; i > esq; --i) {
+        balde.eventos[i] = balde.eventos[i - 1];
+    }
+    balde.eventos[esq] = evento;
+    balde.fim++;
+}
+
+/**
+ * @brief Retira o primeiro (menor) evento de um balde não vazio.
+ * @param balde O balde de origem.
+ * @param evento Recebe o evento retirado.
+ */
+void EscalonadorCalendario::retirar_do_balde(Balde& balde, Evento& evento) {
+    evento = balde.eventos[balde.inicio++];
+    if (balde.inicio == balde.fim) {
+        balde.inicio = balde.fim = 0;
+    }
+}
+
+/**
+ * @brief Redistribui os eventos em uma nova quantidade de baldes.
+ *
+ * A largura das janelas passa a ser cerca de três vezes o espaçamento médio entre as
+ * chaves pendentes, para que cada balde guarde poucos eventos de cada vez, e nunca menos
+ * que uma unidade de tempo (`Evento::PESO_TEMPO`).
+ * @param novo_num_baldes A nova quantidade de baldes (potência de 2).
+ */
+void EscalonadorCalendario::reconstruir(int novo_num_baldes) {
+    Evento* todos = new Evento[tamanho > 0 ? tamanho : 1];
+    int n = 0;
+    long long chave_min = 0, chave_max = 0;
+    for (int i = 0; i < num_baldes; ++i) {
+        for (int j = baldes[i].inicio; j < baldes[i].fim; ++j) {
+            const Evento& e = baldes[i].eventos[j];
+            if (n == 0 || e.chave < chave_min) chave_min = e.chave;
+            if (n == 0 || e.chave > chave_max) chave_max = e.chave;
+            todos[n++] = e;
+        }
+        delete[] baldes[i].eventos;
+    }
+    delete[] baldes;
+
+    if (n > 1) {
+        long long nova_largura = 3 * ((chave_max - chave_min) / n);
+        largura = nova_largura < Evento::PESO_TEMPO ? Evento::PESO_TEMPO : nova_largura;
+    }
+    num_baldes = novo_num_baldes;
+    baldes = new Balde[num_baldes];
+    for (int i = 0; i < num_baldes; ++i) {
+        baldes[i].eventos = nullptr;
+        baldes[i].inicio = baldes[i].fim = baldes[i].capacidade = 0;
+    }
+    for (int i = 0; i < n; ++i) {
+        inserir_no_balde(balde_da_janela(janela_da_chave(todos[i].chave)), todos[i]);
+    }
+    janela_atual = janela_da_chave(chave_min);
+    balde_minimo = -1;
+    delete[] todos;
+}
+
+/**
+ * @brief Insere um evento no balde da janela da sua chave.
+ *
+ * Um evento anterior à janela atual (o que não ocorre na simulação, cujo relógio nunca
+ * retrocede) faz a busca recomeçar a partir da janela dele. Se o mínimo já estava
+ * localizado, ele continua válido, a menos que o novo evento seja menor, caso em que o
+ * novo evento, no início do seu balde, passa a ser o mínimo.
+ * @param evento O evento a ser inserido.
+ */
+void EscalonadorCalendario::insere_evento(const Evento& evento) {
+    long long janela = janela_da_chave(evento.chave);
+    if (tamanho == 0 || janela < janela_atual) {
+        janela_atual = janela;
+    }
+    if (balde_minimo >= 0) {
+        const Balde& atual = baldes[balde_minimo];
+        if (evento.chave < atual.eventos[atual.inicio].chave) {
+            balde_minimo = (int)(janela & (num_baldes - 1));
+            janela_minimo = janela;
+        }
+    } else if (tamanho == 0) {
+        balde_minimo = (int)(janela & (num_baldes - 1));
+        janela_minimo = janela;
+    }
+    inserir_no_balde(balde_da_janela(janela), evento);
+    tamanho++;
+    if (tamanho > 2 * num_baldes) {
+        reconstruir(num_baldes * 2);
+    }
+}
+
+/**
+ * @brief Localiza o balde cujo primeiro evento é o menor evento pendente.
+ *
+ * O resultado de `buscar_minimo` fica guardado até a próxima retirada ou reconstrução (uma
+ * inserção só o substitui se trouxer uma chave menor), então consultas seguidas da menor
+ * chave, como as do ciclo de transportes após cada rota, não repetem a busca.
+ * @param janela Recebe a janela do evento encontrado.
+ * @return O índice do balde (a fila não pode estar vazia).
+ */
+int EscalonadorCalendario::localizar_minimo(long long& janela) const {
+    if (balde_minimo >= 0) {
+        janela = janela_minimo;
+        return balde_minimo;
+    }
+    balde_minimo = buscar_minimo(janela);
+    janela_minimo = janela;
+    return balde_minimo;
+}
+
+/**
+ * @brief Busca, percorrendo os baldes, o balde cujo primeiro evento é o menor pendente.
+ *
+ * Percorre os baldes a partir da janela atual, por no máximo uma volta completa do
+ * calendário. Como todos os eventos de uma mesma janela ficam no mesmo balde, ordenados
+ * pela chave, o primeiro evento encontrado cuja janela já foi alcançada é o mínimo.
+ * Se a volta inteira não encontrar nada, o próximo evento está distante e é localizado
+ * por uma busca direta entre os inícios de todos os baldes.
+ * @param janela Recebe a janela do evento encontrado.
+ * @return O índice do balde (a fila não pode estar vazia).
+ */
+int EscalonadorCalendario::buscar_minimo(long long& janela) const {
+    for (int k = 0; k < num_baldes; ++k) {
+        janela = janela_atual + k;
+        int indice = (int)(janela & (num_baldes - 1));
+        const Balde& balde = baldes[indice];
+        if (balde.inicio < balde.fim && janela_da_chave(balde.eventos[balde.inicio].chave) <= janela) {
+            return indice;
+        }
+    }
+
+    int escolhido = -1;
+    for (int i = 0; i < num_baldes; ++i) {
+        const Balde& balde = baldes[i];
+        if (balde.inicio < balde.fim &&
+            (escolhido < 0 || balde.eventos[balde.inicio].chave < baldes[escolhido].eventos[baldes[escolhido].inicio].chave)) {
+            escolhido = i;
+        }
+    }
+    janela = janela_da_chave(baldes[escolhido].eventos[baldes[escolhido].inicio].chave);
+    return escolhido;
+}
+
+/**
+ * @brief Remove o evento com a menor chave de prioridade.
+ *
+ * O evento é retirado do balde encontrado por `localizar_minimo`, cuja janela passa a ser
+ * a janela atual.
+ * @param evento Recebe o próximo evento.
+ * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
+ */
+bool EscalonadorCalendario::retira_proximo_evento(Evento& evento) {
+    if (vazio()) {
+        return false;
+    }
+
+    long long janela;
+    Balde& escolhido = baldes[localizar_minimo(janela)];
+    janela_atual = janela;
+
+    retirar_do_balde(escolhido, evento);
+    balde_minimo = -1;
+    tamanho--;
+    if (num_baldes > MIN_BALDES && tamanho < num_baldes / 2) {
+        reconstruir(num_baldes / 2);
+    }
+    return true;
+}
+
+/**
+ * @brief Consulta a menor chave pendente, com a mesma busca de `retira_proximo_evento`,
+ * mas sem alterar a janela atual. O balde encontrado fica guardado para a retirada seguinte.
+ * @param chave Recebe a menor chave pendente.
+ * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+ */
+bool EscalonadorCalendario::consulta_proxima_chave(long long& chave) const {
+    if (vazio()) {
+        return false;
+    }
+    long long janela;
+    const Balde& balde = baldes[localizar_minimo(janela)];
+    chave = balde.eventos[balde.inicio].chave;
+    return true;
+}
+
+/**
+ * @brief Verifica se a fila de eventos está vazia.
+ * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
+ */
+bool EscalonadorCalendario::vazio() const {
+    return tamanho == 0;
+}
@@ -0,0 +1,246 @@
+#include "../include/EscalonadorHeap.hpp"
+#include <stdexcept>
+#include <cstdint>
+
+namespace {
+    const std::uintptr_t TAMANHO_LINHA_CACHE = 64;
+}
+
+/**
+ * @brief Constrói um novo EscalonadorHeap com uma capacidade inicial.
+ *
+ * Todas as posições do pool começam na lista de livres.
+ * @param capacidade_inicial A capacidade inicial da fila de eventos.
+ * @param aridade O número de filhos por nó do heap (2, 4 ou 8).
+ * @throws std::invalid_argument Se a aridade não for 2, 4 ou 8.
+ */
+EscalonadorHeap::EscalonadorHeap(int capacidade_inicial, int aridade)
+    : memoria_heap(nullptr), heap(nullptr), aridade(aridade), capacidade(capacidade_inicial), tamanho(0) {
+    if (aridade != 2 && aridade != 4 && aridade != 8) {
+        throw std::invalid_argument("Aridade do escalonador deve ser 2, 4 ou 8.");
+    }
+    if (capacidade < 1) capacidade = 1;
+    eventos = new Evento[capacidade];
+    livres = new int[capacidade];
+    num_livres = capacidade;
+    for (int i = 0; i < capacidade; ++i) {
+        livres[i] = capacidade - 1 - i;
+    }
+    alocar_heap(capacidade);
+}
+
+/**
+ * @brief Destrói o EscalonadorHeap, liberando o pool de eventos e o heap.
+ */
+EscalonadorHeap::~EscalonadorHeap() {
+    delete[] eventos;
+    delete[] livres;
+    delete[] memoria_heap;
+}
+
+/**
+ * @brief Aloca um novo array para o heap e copia os elementos atuais.
+ *
+ * Os filhos do nó `i` ocupam as posições `d*i + 1 .. d*i + d`, então o grupo do nó `i`
+ * começa `16*d*i` bytes (16 bytes por entrada) depois da posição 1. Deslocando o início
+ * lógico do heap para que a posição 1 caia em um limite de linha de cache, todo grupo de
+ * filhos começa alinhado: para d = 4 ele ocupa exatamente uma linha, para d = 8 duas, e
+ * para d = 2 meia linha.
+ * @param nova_capacidade O número de elementos que o novo heap comporta.
+ */
+void EscalonadorHeap::alocar_heap(int nova_capacidade) {
+    int folga = (int)(TAMANHO_LINHA_CACHE / sizeof(EntradaHeap));
+    EntradaHeap* nova_memoria = new EntradaHeap[nova_capacidade + aridade + folga];
+
+    EntradaHeap* novo_heap = nova_memoria;
+    for (int passo = 0; passo < folga; ++passo) {
+        if (reinterpret_cast<std::uintptr_t>(novo_heap + 1) % TAMANHO_LINHA_CACHE == 0) break;
+        ++novo_heap;
+    }
+
+    for (int i = 0; i < tamanho; ++i) {
+        novo_heap[i] = heap[i];
+    }
+    delete[] memoria_heap;
+    memoria_heap = nova_memoria;
+    heap = novo_heap;
+}
+
+/**
+ * @brief Garante espaço para pelo menos `nova_capacidade` eventos no heap e no pool.
+ *
+ * As novas posições do pool entram na lista de livres junto com as que já estavam livres.
+ * @param nova_capacidade A capacidade mínima desejada.
+ */
+void EscalonadorHeap::reservar(int nova_capacidade) {
+    if (nova_capacidade <= capacidade) return;
+
+    Evento* novos_eventos = new Evento[nova_capacidade];
+    for (int i = 0; i < capacidade; ++i) {
+        novos_eventos[i] = eventos[i];
+    }
+    delete[] eventos;
+    eventos = novos_eventos;
+    alocar_heap(nova_capacidade);
+
+    int* novos_livres = new int[nova_capacidade];
+    int n = 0;
+    for (int i = nova_capacidade - 1; i >= capacidade; --i) {
+        novos_livres[n++] = i;
+    }
+    for (int i = 0; i < num_livres; ++i) {
+        novos_livres[n++] = livres[i];
+    }
+    delete[] livres;
+    livres = novos_livres;
+    num_livres = n;
+    capacidade = nova_capacidade;
+}
+
+/**
+ * @brief Move um nó para cima na árvore para manter a propriedade do min-heap.
+ *
+ * Os ancestrais maiores são deslocados para baixo e o elemento é gravado uma única vez
+ * na posição final.
+ * @param i O índice do nó a ser movido para cima.
+ */
+void EscalonadorHeap::subir(int i) {
+    EntradaHeap elemento = heap[i];
+    while (i > 0) {
+        int p = pai(i);
+        if (heap[p].chave <= elemento.chave) break;
+        heap[i] = heap[p];
+        i = p;
+    }
+    heap[i] = elemento;
+}
+
+/**
+ * @brief Move um nó para baixo na árvore para manter a propriedade do min-heap.
+ *
+ * A cada nível, seleciona o menor dentre os filhos contíguos do nó.
+ * @param i O índice do nó a ser movido para baixo.
+ */
+void EscalonadorHeap::descer(int i) {
+    EntradaHeap elemento = heap[i];
+    while (true) {
+        int inicio = primeiro_filho(i);
+        if (inicio >= tamanho) break;
+        int fim = inicio + aridade;
+        if (fim > tamanho) fim = tamanho;
+
+        int min_index = inicio;
+        long long min_chave = heap[inicio].chave;
+        for (int c = inicio + 1; c < fim; ++c) {
+            if (heap[c].chave < min_chave) {
+                min_chave = heap[c].chave;
+                min_index = c;
+            }
+        }
+        if (elemento.chave <= min_chave) break;
+        heap[i] = heap[min_index];
+        i = min_index;
+    }
+    heap[i] = elemento;
+}
+
+/**
+ * @brief Insere um evento na fila de prioridade.
+ *
+ * O evento é copiado para uma posição livre do pool, e o par (chave, posição) é
+ * inserido no heap.
+ * @param evento O evento a ser inserido.
+ */
+void EscalonadorHeap::insere_evento(const Evento& evento) {
+    if (num_livres == 0) {
+        reservar(capacidade * 2);
+    }
+    int posicao = livres[--num_livres];
+    eventos[posicao] = evento;
+    heap[tamanho].chave = evento.chave;
+    heap[tamanho].indice = posicao;
+    tamanho++;
+    subir(tamanho - 1);
+}
+
+/**
+ * @brief Insere um lote de eventos de uma só vez.
+ *
+ * Reserva o espaço necessário uma única vez e acrescenta todos os eventos ao final do heap.
+ * Quando o lote é grande em relação ao heap atual, a propriedade do heap é restaurada pelo
+ * método de Floyd (descendo cada nó interno, do último ao primeiro), em O(n); caso
+ * contrário, cada novo elemento sobe individualmente.
+ * @param lote Os eventos a serem inseridos.
+ */
+void EscalonadorHeap::insere_eventos(const VetorDinamico<Evento>& lote) {
+    int quantidade = lote.tamanho();
+    if (quantidade == 0) return;
+    if (tamanho + quantidade > capacidade) {
+        int nova_capacidade = capacidade;
+        while (nova_capacidade < tamanho + quantidade) nova_capacidade *= 2;
+        reservar(nova_capacidade);
+    }
+
+    int inicio = tamanho;
+    for (int i = 0; i < quantidade; ++i) {
+        int posicao = livres[--num_livres];
+        const Evento& evento = lote.sem_verificacao(i);
+        eventos[posicao] = evento;
+        heap[tamanho].chave = evento.chave;
+        heap[tamanho].indice = posicao;
+        tamanho++;
+    }
+
+    if (quantidade >= inicio) {
+        for (int i = pai(tamanho - 1); i >= 0; --i) {
+            descer(i);
+        }
+    } else {
+        for (int i = inicio; i < tamanho; ++i) {
+            subir(i);
+        }
+    }
+}
+
+/**
+ * @brief Remove o evento com a maior prioridade (menor tempo).
+ *
+ * O registro é copiado para `evento` e sua posição no pool volta para a lista de livres.
+ * @param evento Recebe o próximo evento.
+ * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
+ */
+bool EscalonadorHeap::retira_proximo_evento(Evento& evento) {
+    if (vazio()) {
+        return false;
+    }
+    int raiz = heap[0].indice;
+    evento = eventos[raiz];
+    livres[num_livres++] = raiz;
+    heap[0] = heap[tamanho - 1];
+    tamanho--;
+    if (tamanho > 0) {
+        descer(0);
+    }
+    return true;
+}
+
+/**
+ * @brief Consulta a chave da raiz do heap, sem removê-la.
+ * @param chave Recebe a menor chave pendente.
+ * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+ */
+bool EscalonadorHeap::consulta_proxima_chave(long long& chave) const {
+    if (vazio()) {
+        return false;
+    }
+    chave = heap[0].chave;
+    return true;
+}
+
+/**
+ * @brief Verifica se a fila de prioridade de eventos está vazia.
+ * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
+ */
+bool EscalonadorHeap::vazio() const {
+    return tamanho == 0;
+}
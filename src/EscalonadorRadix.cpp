@@ -0,0 +1,156 @@
+#include "../include/EscalonadorRadix.hpp"
+
+/**
+ * @brief Constrói um radix heap vazio.
+ */
+EscalonadorRadix::EscalonadorRadix() : ultima_chave(0), tamanho(0) {
+    for (int i = 0; i < NUM_BALDES; ++i) {
+        baldes[i].eventos = nullptr;
+        baldes[i].tamanho = baldes[i].capacidade = 0;
+    }
+}
+
+/**
+ * @brief Destrói o radix heap, liberando os arrays de todos os baldes.
+ */
+EscalonadorRadix::~EscalonadorRadix() {
+    for (int i = 0; i < NUM_BALDES; ++i) {
+        delete[] baldes[i].eventos;
+    }
+}
+
+/**
+ * @brief Calcula o balde de uma chave em relação a `ultima_chave`.
+ *
+ * O balde 0 guarda chaves iguais à última retirada; o balde `b > 0` guarda chaves cujo
+ * bit mais significativo diferente de `ultima_chave` é o bit `b - 1`.
+ * @param chave A chave do evento (maior ou igual a `ultima_chave`).
+ * @return O índice do balde, entre 0 e 64.
+ */
+int EscalonadorRadix::indice_balde(long long chave) const {
+    unsigned long long diferenca = (unsigned long long)chave ^ (unsigned long long)ultima_chave;
+    if (diferenca == 0) return 0;
+    return 64 - __builtin_clzll(diferenca);
+}
+
+/**
+ * @brief Acrescenta um evento a um balde, dobrando seu array quando necessário, e atualiza a
+ * menor chave do balde.
+ * @param indice O índice do balde.
+ * @param evento O evento a ser acrescentado.
+ */
+void EscalonadorRadix::adicionar_no_balde(int indice, const Evento& evento) {
+    Balde& balde = baldes[indice];
+    if (balde.tamanho == balde.capacidade) {
+        int nova_capacidade = balde.capacidade == 0 ? 16 : balde.capacidade * 2;
+        Evento* novos = new Evento[nova_capacidade];
+        for (int i = 0; i < balde.tamanho; ++i) {
+            novos[i] = balde.eventos[i];
+        }
+        delete[] balde.eventos;
+        balde.eventos = novos;
+        balde.capacidade = nova_capacidade;
+    }
+    if (balde.tamanho == 0 || evento.chave < balde.menor) balde.menor = evento.chave;
+    balde.eventos[balde.tamanho++] = evento;
+}
+
+/**
+ * @brief Redistribui todos os eventos em relação a uma nova base menor que a atual.
+ *
+ * Só é usado quando um evento chega com chave menor que a última retirada, o que quebra
+ * a hipótese de monotonicidade (por exemplo, latência e custo de remoção nulos). Custa
+ * O(n), mas mantém a ordem exata das chaves.
+ * @param nova_base A nova chave de referência dos baldes.
+ */
+void EscalonadorRadix::rebasear(long long nova_base) {
+    Balde antigos[NUM_BALDES];
+    for (int i = 0; i < NUM_BALDES; ++i) {
+        antigos[i] = baldes[i];
+        baldes[i].eventos = nullptr;
+        baldes[i].tamanho = baldes[i].capacidade = 0;
+    }
+    ultima_chave = nova_base;
+    for (int i = 0; i < NUM_BALDES; ++i) {
+        for (int j = 0; j < antigos[i].tamanho; ++j) {
+            adicionar_no_balde(indice_balde(antigos[i].eventos[j].chave), antigos[i].eventos[j]);
+        }
+        delete[] antigos[i].eventos;
+    }
+}
+
+/**
+ * @brief Insere um evento no balde determinado pela sua chave.
+ * @param evento O evento a ser inserido.
+ */
+void EscalonadorRadix::insere_evento(const Evento& evento) {
+    if (evento.chave < ultima_chave) {
+        rebasear(evento.chave);
+    }
+    adicionar_no_balde(indice_balde(evento.chave), evento);
+    tamanho++;
+}
+
+/**
+ * @brief Remove o evento com a menor chave de prioridade.
+ *
+ * Se o balde 0 estiver vazio, o primeiro balde não vazio tem seu menor evento adotado como
+ * nova base, e seus eventos são redistribuídos em baldes de índice menor.
+ * @param evento Recebe o próximo evento.
+ * @return Verdadeiro se um evento foi retirado, falso se a fila estiver vazia.
+ */
+bool EscalonadorRadix::retira_proximo_evento(Evento& evento) {
+    if (vazio()) {
+        return false;
+    }
+
+    if (baldes[0].tamanho == 0) {
+        int i = 1;
+        while (baldes[i].tamanho == 0) ++i;
+
+        Balde& balde = baldes[i];
+        ultima_chave = balde.menor;
+
+        // Todos os eventos deste balde vão para baldes de índice menor que i.
+        int quantidade = balde.tamanho;
+        balde.tamanho = 0;
+        for (int j = 0; j < quantidade; ++j) {
+            adicionar_no_balde(indice_balde(balde.eventos[j].chave), balde.eventos[j]);
+        }
+    }
+
+    Balde& zero = baldes[0];
+    evento = zero.eventos[--zero.tamanho];
+    tamanho--;
+    return true;
+}
+
+/**
+ * @brief Consulta a menor chave pendente, sem redistribuir os baldes.
+ *
+ * O balde 0 só guarda chaves iguais a `ultima_chave`; fora dele, a menor chave é a do
+ * primeiro balde não vazio, mantida a cada inserção.
+ * @param chave Recebe a menor chave pendente.
+ * @return Verdadeiro se havia algum evento, falso se a fila estiver vazia.
+ */
+bool EscalonadorRadix::consulta_proxima_chave(long long& chave) const {
+    if (vazio()) {
+        return false;
+    }
+    if (baldes[0].tamanho > 0) {
+        chave = ultima_chave;
+        return true;
+    }
+    int i = 1;
+    while (baldes[i].tamanho == 0) ++i;
+    chave = baldes[i].menor;
+    return true;
+}
+
+/**
+ * @brief Verifica se a fila de eventos está vazia.
+ * @return Verdadeiro se a fila estiver vazia, falso caso contrário.
+ */
+bool EscalonadorRadix::vazio() const {
+    return tamanho == 0;
+}
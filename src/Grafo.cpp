@@ -0,0 +1,226 @@
+#include "../include/Grafo.hpp"
+#include "../include/Fila.hpp"
+#include <algorithm> // Para std::sort
+#include <stdexcept>
+
+/**
+ * @brief Constrói um grafo vazio.
+ */
+Grafo::Grafo()
+    : num_vertices(0), num_arestas(0), inicio(nullptr), vizinhos(nullptr), bits(nullptr), palavras_por_linha(0) {}
+
+/**
+ * @brief Destrói o grafo, liberando os arrays alocados.
+ */
+Grafo::~Grafo() {
+    liberar();
+}
+
+/**
+ * @brief Libera as representações alocadas.
+ */
+void Grafo::liberar() {
+    delete[] inicio;
+    delete[] vizinhos;
+    delete[] bits;
+    inicio = nullptr;
+    vizinhos = nullptr;
+    bits = nullptr;
+}
+
+/**
+ * @brief Monta o grafo a partir de uma lista de arestas dirigidas.
+ *
+ * As arestas são primeiro distribuídas em CSR com uma contagem (O(V + E)). Cada lista é então
+ * ordenada, o que é gratuito quando as arestas já chegam em ordem (formato de matriz), e as
+ * repetições são removidas com uma compactação final. Se a representação escolhida for a
+ * densa, o CSR é convertido em matriz de bits.
+ *
+ * @param num_vertices O número de vértices.
+ * @param origens Vértice de origem de cada aresta.
+ * @param destinos Vértice de destino de cada aresta.
+ * @param representacao Formato interno desejado.
+ * @throws std::out_of_range Se alguma aresta referenciar um vértice inexistente.
+ */
+void Grafo::construir(int num_vertices, const VetorDinamico<int>& origens, const VetorDinamico<int>& destinos,
+                      RepresentacaoGrafo representacao) {
+    liberar();
+    this->num_vertices = num_vertices;
+
+    int total = origens.tamanho();
+    inicio = new int[num_vertices + 1];
+    for (int v = 0; v <= num_vertices; ++v) inicio[v] = 0;
+    for (int e = 0; e < total; ++e) {
+        int u = origens[e], v = destinos[e];
+        if (u < 0 || u >= num_vertices || v < 0 || v >= num_vertices) {
+            throw std::out_of_range("Aresta com armazém inexistente.");
+        }
+        inicio[u + 1]++;
+    }
+    for (int v = 0; v < num_vertices; ++v) inicio[v + 1] += inicio[v];
+
+    int* proximo = new int[num_vertices > 0 ? num_vertices : 1];
+    for (int v = 0; v < num_vertices; ++v) proximo[v] = inicio[v];
+    int* lista = new int[total > 0 ? total : 1];
+    for (int e = 0; e < total; ++e) {
+        // Os limites de `origens` e `destinos` já foram verificados no laço anterior.
+        lista[proximo[origens.sem_verificacao(e)]++] = destinos.sem_verificacao(e);
+    }
+    delete[] proximo;
+
+    // Ordena cada lista e descarta repetições, compactando as listas no mesmo array.
+    int escrita = 0;
+    for (int v = 0; v < num_vertices; ++v) {
+        int ini = inicio[v], fim = inicio[v + 1];
+        std::sort(lista + ini, lista + fim);
+        inicio[v] = escrita;
+        for (int i = ini; i < fim; ++i) {
+            if (i == ini || lista[i] != lista[i - 1]) {
+                lista[escrita++] = lista[i];
+            }
+        }
+    }
+    inicio[num_vertices] = escrita;
+    num_arestas = escrita;
+
+    vizinhos = new int[escrita > 0 ? escrita : 1];
+    for (int i = 0; i < escrita; ++i) vizinhos[i] = lista[i];
+    delete[] lista;
+
+    palavras_por_linha = (num_vertices + 63) / 64;
+    bool usar_bits = representacao == RepresentacaoGrafo::DENSA;
+    if (representacao == RepresentacaoGrafo::AUTOMATICA) {
+        // Matriz de bits: V * V / 8 bytes; CSR: 4 bytes por aresta.
+        usar_bits = (long long)num_vertices * palavras_por_linha * 8 < (long long)num_arestas * 4;
+    }
+    if (usar_bits) {
+        compactar_em_bits();
+    }
+}
+
+/**
+ * @brief Converte o CSR já montado em matriz de bits e descarta o CSR.
+ */
+void Grafo::compactar_em_bits() {
+    long long total_palavras = (long long)num_vertices * palavras_por_linha;
+    bits = new unsigned long long[total_palavras > 0 ? total_palavras : 1];
+    for (long long i = 0; i < total_palavras; ++i) bits[i] = 0;
+    for (int u = 0; u < num_vertices; ++u) {
+        unsigned long long* linha = bits + (long long)u * palavras_por_linha;
+        for (int i = inicio[u]; i < inicio[u + 1]; ++i) {
+            linha[vizinhos[i] / 64] |= 1ULL << (vizinhos[i] % 64);
+        }
+    }
+    delete[] inicio;
+    delete[] vizinhos;
+    inicio = nullptr;
+    vizinhos = nullptr;
+}
+
+/**
+ * @brief Indica se existe a aresta dirigida `u -> v`.
+ *
+ * Na matriz de bits, é um teste de bit; no CSR, uma busca binária na lista (ordenada) de
+ * vizinhos de `u`.
+ * @param u O vértice de origem.
+ * @param v O vértice de destino.
+ * @return Verdadeiro se a aresta existe.
+ */
+bool Grafo::tem_aresta(int u, int v) const {
+    if (bits) {
+        return (bits[(long long)u * palavras_por_linha + v / 64] >> (v % 64)) & 1ULL;
+    }
+    return std::binary_search(vizinhos + inicio[u], vizinhos + inicio[u + 1], v);
+}
+
+/**
+ * @brief Calcula a árvore de antecessores de um BFS a partir de `origem`.
+ * @param origem O vértice de partida.
+ * @param antecessor Recebe o antecessor de cada vértice.
+ */
+void Grafo::calcular_arvore_bfs(int origem, int* antecessor) const {
+    for (int i = 0; i < num_vertices; ++i) {
+        antecessor[i] = -1;
+    }
+    if (bits) {
+        bfs_denso(origem, antecessor);
+    } else {
+        bfs_esparso(origem, antecessor);
+    }
+}
+
+/**
+ * @brief BFS sobre o CSR, com fila de vértices.
+ *
+ * Não aloca memória a cada chamada: um vértice está visitado se for a origem ou já tiver
+ * antecessor (o array chega preenchido com -1), e a fila é reutilizada entre chamadas da
+ * mesma thread, com capacidade reservada para todos os vértices.
+ * @param origem O vértice de partida.
+ * @param antecessor Recebe o antecessor de cada vértice.
+ */
+void Grafo::bfs_esparso(int origem, int* antecessor) const {
+    static thread_local Fila<int> fila; // Fila para o BFS, reutilizada entre chamadas.
+    fila.limpar();
+    fila.reservar(num_vertices);
+    fila.enfileirar(origem);
+
+    // Loop principal do BFS, percorrendo todo o componente da origem.
+    while (!fila.esta_vazia()) {
+        int u = fila.desenfileirar();
+        for (int i = inicio[u]; i < inicio[u + 1]; ++i) {
+            int v = vizinhos[i];
+            if (antecessor[v] == -1 && v != origem) {
+                antecessor[v] = u;
+                fila.enfileirar(v);
+            }
+        }
+    }
+}
+
+/**
+ * @brief BFS sobre a matriz de bits.
+ *
+ * Mantém um conjunto de bits dos vértices ainda não visitados. Para cada vértice retirado da
+ * fila, a linha dele é combinada com esse conjunto por AND, uma palavra de 64 vértices por vez,
+ * e os bits resultantes (em ordem crescente) são os vértices descobertos, na mesma ordem em que
+ * o BFS com fila os encontraria. Como no BFS esparso, os buffers são reutilizados entre
+ * chamadas da mesma thread.
+ * @param origem O vértice de partida.
+ * @param antecessor Recebe o antecessor de cada vértice.
+ */
+void Grafo::bfs_denso(int origem, int* antecessor) const {
+    static thread_local VetorDinamico<unsigned long long> conjunto; // Reutilizado entre chamadas.
+    static thread_local VetorDinamico<int> vertices;                // Reutilizado entre chamadas.
+    conjunto.ajustar_tamanho(palavras_por_linha);
+    vertices.ajustar_tamanho(num_vertices);
+
+    unsigned long long* nao_visitados = conjunto.begin();
+    for (int w = 0; w < palavras_por_linha; ++w) nao_visitados[w] = ~0ULL;
+    if (num_vertices % 64 != 0) {
+        nao_visitados[palavras_por_linha - 1] = (1ULL << (num_vertices % 64)) - 1;
+    }
+    nao_visitados[origem / 64] &= ~(1ULL << (origem % 64));
+
+    // Cada vértice entra na fila uma única vez, então um array de V posições basta.
+    int* fila = vertices.begin();
+    int frente = 0, tras = 0;
+    fila[tras++] = origem;
+    int restantes = num_vertices - 1;
+
+    while (frente < tras && restantes > 0) {
+        int u = fila[frente++];
+        const unsigned long long* linha = bits + (long long)u * palavras_por_linha;
+        for (int w = 0; w < palavras_por_linha; ++w) {
+            unsigned long long novos = linha[w] & nao_visitados[w];
+            if (!novos) continue;
+            nao_visitados[w] &= ~novos;
+            while (novos) {
+                int v = w * 64 + __builtin_ctzll(novos);
+                antecessor[v] = u;
+                fila[tras++] = v;
+                restantes--;
+                novos &= novos - 1;
+            }
+        }
+    }
+}
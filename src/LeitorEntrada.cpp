@@ -0,0 +1,194 @@
+#include "../include/LeitorEntrada.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>      // Para open
+#include <sys/mman.h>   // Para mmap
+#include <sys/stat.h>   // Para fstat
+#include <unistd.h>     // Para read, close e sysconf
+
+/**
+ * @brief Indica se `c` separa tokens: o espaço e todos os caracteres de controle (incluindo
+ * '\n', '\r' e '\t'), o que reduz o teste a uma única comparação.
+ */
+static inline bool e_espaco(char c) {
+    return (unsigned char)c <= ' ';
+}
+
+/**
+ * @brief Abre o arquivo e mapeia todo o seu conteúdo para leitura.
+ *
+ * Arquivos regulares são mapeados com `mmap`, com acesso sequencial indicado ao kernel.
+ * Se o descritor não puder ser mapeado (pipes, dispositivos), o conteúdo é lido em blocos
+ * para um buffer que cresce conforme a necessidade.
+ * @param nome_arquivo Caminho do arquivo.
+ */
+LeitorEntrada::LeitorEntrada(const std::string& nome_arquivo)
+    : inicio(nullptr), atual(nullptr), fim(nullptr), tamanho_mapa(0), liberado(0), copia(nullptr) {
+    int descritor = ::open(nome_arquivo.c_str(), O_RDONLY);
+    if (descritor < 0) {
+        throw std::runtime_error("Erro ao abrir o arquivo de entrada: " + nome_arquivo);
+    }
+
+    struct stat info;
+    if (::fstat(descritor, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+        void* mapa = ::mmap(nullptr, (std::size_t)info.st_size, PROT_READ, MAP_PRIVATE, descritor, 0);
+        if (mapa != MAP_FAILED) {
+            ::madvise(mapa, (std::size_t)info.st_size, MADV_SEQUENTIAL);
+            tamanho_mapa = (std::size_t)info.st_size;
+            inicio = static_cast<const char*>(mapa);
+        }
+    }
+
+    std::size_t tamanho = tamanho_mapa;
+    if (!inicio) {
+        std::size_t capacidade = 1 << 16;
+        copia = new char[capacidade];
+        for (;;) {
+            if (tamanho == capacidade) {
+                char* maior = new char[capacidade * 2];
+                std::memcpy(maior, copia, tamanho);
+                delete[] copia;
+                copia = maior;
+                capacidade *= 2;
+            }
+            ssize_t n = ::read(descritor, copia + tamanho, capacidade - tamanho);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                delete[] copia;
+                ::close(descritor);
+                throw std::runtime_error("Erro ao ler o arquivo de entrada: " + nome_arquivo);
+            }
+            if (n == 0) break;
+            tamanho += (std::size_t)n;
+        }
+        inicio = copia;
+    }
+    ::close(descritor);
+
+    atual = inicio;
+    fim = inicio + tamanho;
+}
+
+/**
+ * @brief Desfaz o mapeamento do arquivo ou libera a cópia lida.
+ */
+LeitorEntrada::~LeitorEntrada() {
+    if (tamanho_mapa > 0) ::munmap(const_cast<char*>(inicio), tamanho_mapa);
+    delete[] copia;
+}
+
+/**
+ * @brief Avança a posição de leitura até o próximo caractere que não seja espaço.
+ */
+void LeitorEntrada::pular_espacos() {
+    while (atual < fim && (unsigned char)*atual <= ' ') ++atual;
+}
+
+/**
+ * @brief Lança um `std::runtime_error` descrevendo a posição e o conteúdo do token inválido.
+ *
+ * A linha e a coluna são calculadas só aqui, contando as quebras de linha desde o início,
+ * para que a leitura normal não precise acompanhá-las.
+ * @param token Início do trecho inválido.
+ * @param esperado Descrição do que se esperava nessa posição.
+ */
+void LeitorEntrada::falhar(const char* token, const std::string& esperado) const {
+    int linha = 1 + (int)std::count(inicio, token, '\n');
+    const char* inicio_linha = token;
+    while (inicio_linha > inicio && inicio_linha[-1] != '\n') --inicio_linha;
+    int coluna = 1 + (int)(token - inicio_linha);
+
+    std::string encontrado;
+    if (token >= fim) {
+        encontrado = "fim do arquivo";
+    } else {
+        const char* fim_token = token;
+        while (fim_token < fim && !e_espaco(*fim_token) && fim_token - token < 32) ++fim_token;
+        encontrado = "\"" + std::string(token, fim_token) + "\"";
+    }
+    throw std::runtime_error("Entrada inválida (linha " + std::to_string(linha) + ", coluna " +
+                             std::to_string(coluna) + "): esperado " + esperado + ", encontrado " + encontrado + ".");
+}
+
+/**
+ * @brief Lê o próximo inteiro decimal, rejeitando tokens que não sejam só dígitos.
+ * @param campo Nome do campo, usado na mensagem de erro.
+ * @param minimo Menor valor aceito.
+ * @param maximo Maior valor aceito.
+ * @return O inteiro lido.
+ */
+int LeitorEntrada::ler_inteiro(const char* campo, long long minimo, long long maximo) {
+    pular_espacos();
+    const char* token = atual;
+    const char* p = atual;
+    bool negativo = false;
+    if (p < fim && (*p == '-' || *p == '+')) {
+        negativo = *p == '-';
+        ++p;
+    }
+    const char* digitos = p;
+    long long valor = 0;
+    bool estouro = false;
+    while (p < fim && (unsigned)(*p - '0') < 10u) {
+        // Acima de 12 dígitos o valor já está fora de qualquer faixa de `int`; não acumula mais.
+        if (valor < 1000000000000LL) valor = valor * 10 + (*p - '0');
+        else estouro = true;
+        ++p;
+    }
+    if (p == digitos || (p < fim && (unsigned char)*p > ' ')) {
+        falhar(token, std::string(campo) + " (inteiro)");
+    }
+    if (negativo) valor = -valor;
+    if (estouro || valor < minimo || valor > maximo) {
+        if (minimo == INT_MIN && maximo == INT_MAX) falhar(token, std::string(campo) + " (inteiro de 32 bits)");
+        falhar(token, std::string(campo) + " entre " + std::to_string(minimo) + " e " + std::to_string(maximo));
+    }
+    atual = p;
+    return (int)valor;
+}
+
+/**
+ * @brief Confere e pula uma palavra fixa do formato.
+ * @param palavra A palavra esperada.
+ */
+void LeitorEntrada::esperar_palavra(const char* palavra) {
+    pular_espacos();
+    const char* esperada = palavra;
+    const char* p = atual;
+    while (*palavra && p < fim && *p == *palavra) {
+        ++p;
+        ++palavra;
+    }
+    if (*palavra || (p < fim && !e_espaco(*p))) {
+        falhar(atual, std::string("\"") + esperada + "\"");
+    }
+    atual = p;
+}
+
+/**
+ * @brief Verifica, sem consumir nada, se o próximo token começa com uma letra.
+ * @return Verdadeiro se o próximo token é uma palavra.
+ */
+bool LeitorEntrada::proximo_e_palavra() {
+    pular_espacos();
+    return atual < fim && ((*atual >= 'a' && *atual <= 'z') || (*atual >= 'A' && *atual <= 'Z'));
+}
+
+/**
+ * @brief Devolve ao sistema as páginas inteiras do mapa que ficam antes da posição de leitura.
+ *
+ * O mapeamento é privado e nunca escrito, então uma página devolvida com `MADV_DONTNEED`
+ * volta a ser lida do arquivo se for acessada de novo (por exemplo, ao contar as linhas
+ * de uma mensagem de erro).
+ */
+void LeitorEntrada::liberar_lidos() {
+    if (tamanho_mapa == 0) return;
+    std::size_t pagina = (std::size_t)::sysconf(_SC_PAGESIZE);
+    std::size_t lidos = (std::size_t)(atual - inicio) / pagina * pagina;
+    if (lidos > liberado) {
+        ::madvise(const_cast<char*>(inicio) + liberado, lidos - liberado, MADV_DONTNEED);
+        liberado = lidos;
+    }
+}
@@ -1,4 +1,5 @@
 #include "../include/Pacote.hpp"
+#include "../include/TabelaRotas.hpp"
 
 /**
  * @brief Constrói um novo objeto Pacote.
@@ -9,34 +10,37 @@
  */
 Pacote::Pacote(int id, int tempo_postagem, int origem, int destino)
     : id(id), display_id(id % 100), tempo_postagem(tempo_postagem), armazem_origem(origem), armazem_destino(destino),
-      estado_atual(EstadoPacote::NAO_POSTADO), proximo_armazem_index(0),
-      tempo_total_armazenado(0.0), tempo_total_em_transporte(0.0) {}
+      estado_atual(EstadoPacote::NAO_POSTADO), proximo_salto(TabelaRotas::ROTA_VAZIA), posicao(-1),
+      inicio_armazenamento(0) {}
 
 /**
- * @brief Define a rota para o pacote.
- * @param nova_rota A rota a ser seguida pelo pacote.
+ * @brief Define a rota do pacote, a partir do primeiro armazém (a origem).
+ * @param inicio_rota A posição do primeiro salto da rota, compartilhada com os demais pacotes
+ *        do mesmo par. Se o destino for inalcançável, a rota contém apenas o destino.
  */
-void Pacote::definir_rota(const VetorDinamico<int>& nova_rota) {
-    rota = nova_rota;
+void Pacote::definir_rota(int inicio_rota) {
+    proximo_salto = inicio_rota;
 }
 
 /**
  * @brief Obtém o próximo armazém de destino na rota do pacote.
+ *
+ * A rota é contígua no array de saltos, então a consulta é um acesso direto, sem percorrer a
+ * árvore de BFS.
+ * @param rotas A tabela que guarda a rota do pacote.
  * @return O ID do próximo armazém, ou -1 se a rota estiver completa.
  */
-int Pacote::obter_proximo_destino() {
-    if (proximo_armazem_index < rota.tamanho()) {
-        return rota[proximo_armazem_index];
-    }
-    return -1; // Indica que chegou ao destino final ou não há mais rota
+int Pacote::obter_proximo_destino(const TabelaRotas& rotas) const {
+    return rotas.salto(proximo_salto);
 }
 
 /**
  * @brief Avança o pacote para o próximo armazém em sua rota.
+ * @param rotas A tabela que guarda a rota do pacote; o pacote não passa do marcador de fim.
  */
-void Pacote::avancar_rota() {
-    if (proximo_armazem_index < rota.tamanho()) {
-        proximo_armazem_index++;
+void Pacote::avancar_rota(const TabelaRotas& rotas) {
+    if (rotas.salto(proximo_salto) != -1) {
+        proximo_salto++;
     }
 }
 
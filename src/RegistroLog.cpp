@@ -0,0 +1,209 @@
+#include "../include/RegistroLog.hpp"
+#include <cerrno>
+#include <stdexcept>
+#include <unistd.h> // Para read
+
+namespace {
+
+const char ASSINATURA[4] = {'T', 'P', '2', 'L'};
+const unsigned char VERSAO = 1;
+const unsigned char OPCAO_DELTA = 1;
+const unsigned char OPCAO_IDS_LARGOS = 2;
+const unsigned char OPERACAO_ESCAPE = 0xFF;
+const int TAMANHO_CABECALHO = 8;
+
+/** @brief Textos de cada operação: ação antes do armazém e complemento antes da seção. */
+const char* const ACOES[] = {" entregue em ", " armazenado em ", " removido de ", " em transito de ", " rearmazenado em "};
+const char* const COMPLEMENTOS[] = {nullptr, " na secao ", " na secao ", " para ", " na secao "};
+const int NUM_OPERACOES = 5;
+
+/** @brief Escreve `bytes` bytes de `valor` em little-endian. */
+inline void escrever_le(char*& destino, unsigned int valor, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        *destino++ = (char)(valor >> (8 * i));
+    }
+}
+
+/** @brief Lê um inteiro com sinal de `bytes` bytes em little-endian. */
+inline int ler_le(const unsigned char*& origem, int bytes) {
+    unsigned int valor = 0;
+    for (int i = 0; i < bytes; ++i) {
+        valor |= (unsigned int)*origem++ << (8 * i);
+    }
+    if (bytes < 4 && (valor & (1u << (8 * bytes - 1)))) {
+        valor |= ~0u << (8 * bytes); // Estende o sinal.
+    }
+    return (int)valor;
+}
+
+} // namespace
+
+/**
+ * @brief Converte o nome de um formato de log no tipo correspondente.
+ * @param nome "texto", "binario", "binario-delta" ou "resumo".
+ * @return O formato correspondente.
+ * @throws std::invalid_argument Se o nome não corresponder a nenhum formato.
+ */
+FormatoLog formato_log_por_nome(const std::string& nome) {
+    if (nome == "texto") return FormatoLog::TEXTO;
+    if (nome == "binario") return FormatoLog::BINARIO;
+    if (nome == "binario-delta") return FormatoLog::BINARIO_DELTA;
+    if (nome == "resumo") return FormatoLog::RESUMO;
+    throw std::invalid_argument("Formato de log desconhecido: " + nome);
+}
+
+/**
+ * @brief Escreve um registro no formato de texto do log.
+ * @param saida O escritor de destino.
+ * @param tempo O tempo do registro.
+ * @param pacote O ID de exibição do pacote.
+ * @param operacao A operação registrada.
+ * @param armazem O armazém da operação.
+ * @param secao A seção (ou o armazém de destino); ignorada em `ENTREGUE`.
+ */
+void escrever_registro_texto(SaidaLog& saida, int tempo, int pacote, OperacaoLog operacao, int armazem, int secao) {
+    int indice = (int)operacao;
+    saida.iniciar_linha();
+    saida.escrever_inteiro(tempo, 7);
+    saida.escrever(" pacote ", 8);
+    saida.escrever_inteiro(pacote, 3);
+    saida.escrever_texto(ACOES[indice]);
+    saida.escrever_inteiro(armazem, 3);
+    if (COMPLEMENTOS[indice]) {
+        saida.escrever_texto(COMPLEMENTOS[indice]);
+        saida.escrever_inteiro(secao, 3);
+    }
+}
+
+/**
+ * @brief Constrói o codificador e escreve o cabeçalho.
+ * @param saida O escritor de destino.
+ * @param delta Se os tempos devem ser codificados em delta.
+ * @param ids_largos Se armazém e seção usam 32 bits.
+ */
+CodificadorLogBinario::CodificadorLogBinario(SaidaLog& saida, bool delta, bool ids_largos)
+    : saida(saida), delta(delta), ids_largos(ids_largos), ultimo_tempo(0) {
+    char cabecalho[TAMANHO_CABECALHO] = {ASSINATURA[0], ASSINATURA[1], ASSINATURA[2], ASSINATURA[3],
+                                         (char)VERSAO,
+                                         (char)((delta ? OPCAO_DELTA : 0) | (ids_largos ? OPCAO_IDS_LARGOS : 0)),
+                                         0, 0};
+    saida.escrever(cabecalho, TAMANHO_CABECALHO);
+}
+
+/**
+ * @brief Escreve um registro, precedido de um escape se o delta de tempo não couber em 16 bits.
+ * @param tempo O tempo do registro.
+ * @param pacote O ID de exibição do pacote.
+ * @param operacao A operação registrada.
+ * @param armazem O armazém da operação.
+ * @param secao A seção (ou o armazém de destino).
+ */
+void CodificadorLogBinario::registrar(int tempo, int pacote, OperacaoLog operacao, int armazem, int secao) {
+    const int tamanho = tamanho_registro(delta, ids_largos);
+    char registro[16];
+    char* p;
+
+    int campo_tempo = tempo;
+    if (delta) {
+        long long diferenca = (long long)tempo - ultimo_tempo;
+        if (diferenca < -32768 || diferenca > 32767) {
+            p = registro;
+            escrever_le(p, 0, 2);
+            *p++ = (char)OPERACAO_ESCAPE;
+            *p++ = 0;
+            escrever_le(p, (unsigned int)tempo, 4);
+            while (p < registro + tamanho) *p++ = 0;
+            saida.escrever(registro, tamanho);
+            diferenca = 0;
+        }
+        campo_tempo = (int)diferenca;
+        ultimo_tempo = tempo;
+    }
+
+    p = registro;
+    escrever_le(p, (unsigned int)campo_tempo, delta ? 2 : 4);
+    *p++ = (char)operacao;
+    *p++ = (char)pacote;
+    escrever_le(p, (unsigned int)armazem, ids_largos ? 4 : 2);
+    escrever_le(p, (unsigned int)secao, ids_largos ? 4 : 2);
+    saida.escrever(registro, tamanho);
+}
+
+/**
+ * @brief Converte um log binário de volta para o formato de texto.
+ *
+ * Os registros são lidos em blocos de 64 KiB; um registro que atravesse o fim de um bloco é
+ * completado com o início do bloco seguinte.
+ * @param descritor_entrada Descritor de onde o log binário é lido.
+ * @param saida O escritor de destino do texto.
+ * @throws std::runtime_error Se o cabeçalho for inválido, o log estiver truncado ou a leitura falhar.
+ */
+void decodificar_log_binario(int descritor_entrada, SaidaLog& saida) {
+    const int TAMANHO_BLOCO = 1 << 16;
+    unsigned char* bloco = new unsigned char[TAMANHO_BLOCO];
+    int ocupado = 0;
+    bool fim = false;
+
+    // Completa o bloco com novos bytes lidos, até enchê-lo ou o arquivo acabar.
+    auto completar = [&]() {
+        while (!fim && ocupado < TAMANHO_BLOCO) {
+            ssize_t n = ::read(descritor_entrada, bloco + ocupado, TAMANHO_BLOCO - ocupado);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                delete[] bloco;
+                throw std::runtime_error("Falha ao ler o log binário.");
+            }
+            if (n == 0) fim = true;
+            ocupado += (int)n;
+        }
+    };
+
+    completar();
+    if (ocupado < TAMANHO_CABECALHO || bloco[0] != ASSINATURA[0] || bloco[1] != ASSINATURA[1] ||
+        bloco[2] != ASSINATURA[2] || bloco[3] != ASSINATURA[3] || bloco[4] != VERSAO) {
+        delete[] bloco;
+        throw std::runtime_error("Cabeçalho de log binário inválido.");
+    }
+    const bool delta = (bloco[5] & OPCAO_DELTA) != 0;
+    const bool ids_largos = (bloco[5] & OPCAO_IDS_LARGOS) != 0;
+    const int tamanho = CodificadorLogBinario::tamanho_registro(delta, ids_largos);
+    const int bytes_id = ids_largos ? 4 : 2;
+
+    int posicao = TAMANHO_CABECALHO;
+    int tempo = 0;
+    while (true) {
+        if (ocupado - posicao < tamanho) {
+            // Move o resto para o início do bloco e lê mais.
+            int resto = ocupado - posicao;
+            for (int i = 0; i < resto; ++i) bloco[i] = bloco[posicao + i];
+            ocupado = resto;
+            posicao = 0;
+            completar();
+            if (ocupado == 0) break;
+            if (ocupado < tamanho) {
+                delete[] bloco;
+                throw std::runtime_error("Log binário truncado.");
+            }
+        }
+
+        const unsigned char* p = bloco + posicao;
+        int campo_tempo = ler_le(p, delta ? 2 : 4);
+        unsigned char operacao = *p++;
+        int pacote = (signed char)*p++;
+        posicao += tamanho;
+
+        if (operacao == OPERACAO_ESCAPE) {
+            tempo = ler_le(p, 4);
+            continue;
+        }
+        if (operacao >= NUM_OPERACOES) {
+            delete[] bloco;
+            throw std::runtime_error("Operação desconhecida no log binário.");
+        }
+        tempo = delta ? tempo + campo_tempo : campo_tempo;
+        int armazem = ler_le(p, bytes_id);
+        int secao = ler_le(p, bytes_id);
+        escrever_registro_texto(saida, tempo, pacote, (OperacaoLog)operacao, armazem, secao);
+    }
+    delete[] bloco;
+}
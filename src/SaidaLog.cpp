@@ -0,0 +1,103 @@
+#include "../include/SaidaLog.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <unistd.h> // Para write
+
+/**
+ * @brief Constrói o escritor, alocando o buffer.
+ * @param descritor Descritor de arquivo de destino.
+ * @param capacidade Tamanho do buffer, em bytes.
+ */
+SaidaLog::SaidaLog(int descritor, int capacidade)
+    : descritor(descritor), buffer(new char[capacidade]), capacidade(capacidade), ocupado(0), linha_aberta(false) {}
+
+/**
+ * @brief Descarrega o que restar no buffer e o libera.
+ *
+ * Erros de escrita são ignorados aqui, já que destrutores não devem lançar exceções;
+ * quem precisar detectá-los deve chamar `descarregar` antes.
+ */
+SaidaLog::~SaidaLog() {
+    try {
+        descarregar();
+    } catch (...) {
+    }
+    delete[] buffer;
+}
+
+/**
+ * @brief Escreve uma sequência de bytes, passando direto ao descritor se não couber no buffer.
+ * @param dados Os bytes a escrever.
+ * @param tamanho O número de bytes.
+ */
+void SaidaLog::escrever(const char* dados, int tamanho) {
+    if (tamanho > capacidade) {
+        descarregar();
+        enviar(dados, tamanho);
+        return;
+    }
+    garantir_espaco(tamanho);
+    std::memcpy(buffer + ocupado, dados, tamanho);
+    ocupado += tamanho;
+}
+
+/**
+ * @brief Escreve um texto terminado em '\0'.
+ * @param texto O texto a escrever.
+ */
+void SaidaLog::escrever_texto(const char* texto) {
+    escrever(texto, (int)std::strlen(texto));
+}
+
+/**
+ * @brief Escreve um inteiro em decimal com zeros à esquerda até `largura` caracteres.
+ * @param valor O inteiro.
+ * @param largura A largura mínima do campo.
+ */
+void SaidaLog::escrever_inteiro(long long valor, int largura) {
+    char digitos[20];
+    int num_digitos = 0;
+    unsigned long long resto = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+    do {
+        digitos[num_digitos++] = (char)('0' + resto % 10);
+        resto /= 10;
+    } while (resto);
+
+    int comprimento = num_digitos + (valor < 0 ? 1 : 0);
+    int zeros = largura > comprimento ? largura - comprimento : 0;
+    garantir_espaco(zeros + comprimento);
+    char* saida = buffer + ocupado;
+    for (int i = 0; i < zeros; ++i) *saida++ = '0';
+    if (valor < 0) *saida++ = '-';
+    while (num_digitos) *saida++ = digitos[--num_digitos];
+    ocupado = (int)(saida - buffer);
+}
+
+/**
+ * @brief Envia bytes ao descritor, repetindo escritas parciais ou interrompidas.
+ * @param dados Os bytes a enviar.
+ * @param tamanho O número de bytes.
+ * @throws std::runtime_error Se a escrita falhar.
+ */
+void SaidaLog::enviar(const char* dados, int tamanho) {
+    int enviado = 0;
+    while (enviado < tamanho) {
+        ssize_t n = ::write(descritor, dados + enviado, tamanho - enviado);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("Falha ao escrever o log.");
+        }
+        enviado += (int)n;
+    }
+}
+
+/**
+ * @brief Envia ao descritor todo o conteúdo do buffer.
+ * @throws std::runtime_error Se a escrita falhar.
+ */
+void SaidaLog::descarregar() {
+    int pendente = ocupado;
+    ocupado = 0;
+    enviar(buffer, pendente);
+}
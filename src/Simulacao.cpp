@@ -1,11 +1,63 @@
 #include "../include/Simulacao.hpp"
-#include "../include/Fila.hpp"
-#include <iostream>
-#include <fstream>
-#include <sstream>
 #include <algorithm> // Para std::reverse
-#include <iomanip>   // Para std::setw e std::setfill
 #include <stdexcept>
+#include <climits>  // Para INT_MIN, INT_MAX, LLONG_MIN e LLONG_MAX
+#include <cmath>    // Para std::round
+#include <cstdio>   // Para std::snprintf
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Registra uma operação no log.
+ *
+ * Os contadores de `metricas` são sempre atualizados. No formato texto, a linha é escrita
+ * diretamente no buffer de saída; nos formatos binários, apenas o registro de tamanho fixo
+ * é gravado, sem formatação; no formato resumo, nada é escrito.
+ * @param tempo O tempo do registro.
+ * @param pacote O pacote registrado.
+ * @param operacao A operação registrada.
+ * @param armazem O armazém da operação.
+ * @param secao A seção (ou o armazém de destino, em trânsito); ignorada em `ENTREGUE`.
+ */
+void Simulacao::registrar_log(int tempo, const Pacote* pacote, OperacaoLog operacao, int armazem, int secao) {
+    switch (operacao) {
+        case OperacaoLog::ENTREGUE:
+            metricas.entregas++;
+            metricas.makespan = tempo;
+            break;
+        case OperacaoLog::ARMAZENADO: metricas.armazenamentos++; break;
+        case OperacaoLog::REMOVIDO: metricas.remocoes++; break;
+        case OperacaoLog::EM_TRANSITO: metricas.transportes++; break;
+        case OperacaoLog::REARMAZENADO: metricas.rearmazenamentos++; break;
+    }
+
+    if (opcoes.formato_log == FormatoLog::RESUMO) {
+        return;
+    }
+    if (codificador_binario) {
+        codificador_binario->registrar(tempo, pacote->display_id, operacao, armazem, secao);
+    } else {
+        escrever_registro_texto(saida, tempo, pacote->display_id, operacao, armazem, secao);
+    }
+}
+
+/**
+ * @brief Escreve as métricas agregadas em uma única linha, sem quebra ao final.
+ *
+ * Formato: `makespan=M entregas=N armazenamentos=N remocoes=N transportes=N
+ * rearmazenamentos=N tempo_medio_armazenado=X.XX`.
+ */
+void Simulacao::escrever_resumo() {
+    char linha[320];
+    int tamanho = std::snprintf(linha, sizeof(linha),
+        "makespan=%d entregas=%lld armazenamentos=%lld remocoes=%lld transportes=%lld "
+        "rearmazenamentos=%lld tempo_medio_armazenado=%.2f",
+        metricas.makespan, metricas.entregas, metricas.armazenamentos, metricas.remocoes,
+        metricas.transportes, metricas.rearmazenamentos, metricas.tempo_medio_armazenado());
+    saida.iniciar_linha();
+    saida.escrever(linha, tamanho);
+}
 
 /**
  * @brief Constrói um novo objeto Simulacao.
@@ -14,18 +66,25 @@
  * de configuração do arquivo especificado e agenda os eventos iniciais.
  * 
  * @param nome_arquivo O caminho para o arquivo de entrada contendo os dados da simulação.
+ * @param opcoes Opções de execução, como a implementação do escalonador de eventos.
  */
-void Simulacao::print_log_line(const std::string& line) {
-    if (!last_line_buffer.empty()) {
-        std::cout << last_line_buffer << std::endl;
+Simulacao::Simulacao(const std::string& nome_arquivo, const OpcoesSimulacao& opcoes) : opcoes(opcoes), tempo_atual(0), transporte_config(nullptr), num_armazens(0), pacotes_pendentes(0), leitor_pacotes(nullptr), pacotes_nao_lidos(0), proximo_carregado(0), pacote_adiado(nullptr), ultimo_tempo_lido(INT_MIN), horizonte_leitura(0), chave_maxima_processada(LLONG_MIN), codificador_binario(nullptr) {
+    escalonador = Escalonador::criar(opcoes.escalonador);
+    try {
+        carregar_dados(nome_arquivo);
+        if (opcoes.formato_log == FormatoLog::BINARIO || opcoes.formato_log == FormatoLog::BINARIO_DELTA) {
+            // Acima de 32767 armazéns, os IDs não cabem em 16 bits.
+            codificador_binario = new CodificadorLogBinario(saida, opcoes.formato_log == FormatoLog::BINARIO_DELTA,
+                                                            num_armazens > 32767);
+        }
+        // Sem intervalo positivo não há grade de transportes para acompanhar sob demanda.
+        if (transporte_config->intervalo <= 0) this->opcoes.modo_transporte = ModoTransporte::PERIODICO;
+        agendar_eventos_iniciais();
+    } catch (...) {
+        // Uma entrada malformada interrompe a construção, e o destrutor não seria chamado.
+        limpar_memoria();
+        throw;
     }
-    last_line_buffer = line;
-}
-
-Simulacao::Simulacao(const std::string& nome_arquivo) : tempo_atual(0), transporte_config(nullptr), num_armazens(0), matriz_adjacencia(nullptr) {
-    escalonador = new Escalonador();
-    carregar_dados(nome_arquivo);
-    agendar_eventos_iniciais();
 }
 
 /**
@@ -42,145 +101,396 @@ Simulacao::~Simulacao() {
  * @brief Libera toda a memória alocada dinamicamente pela simulação.
  * 
  * Garante que não haja vazamentos de memória ao deletar o `transporte_config`,
- * o `escalonador`, todos os `armazens` e `pacotes`, e a `matriz_adjacencia`.
+ * o `escalonador`, todos os `armazens` e os pacotes ainda não entregues ou não agendados. As
+ * rotas compartilhadas são liberadas pela própria `TabelaRotas`.
  */
 void Simulacao::limpar_memoria() {
     delete transporte_config;
     delete escalonador;
+    delete codificador_binario;
+    delete leitor_pacotes;
 
     for (int i = 0; i < armazens.tamanho(); ++i) delete armazens[i];
     for (int i = 0; i < pacotes.tamanho(); ++i) delete pacotes[i];
-
-    if (matriz_adjacencia) {
-        for (int i = 0; i < num_armazens; ++i) delete[] matriz_adjacencia[i];
-        delete[] matriz_adjacencia;
-    }
+    for (int i = proximo_carregado; i < pacotes_carregados.tamanho(); ++i) delete pacotes_carregados[i];
+    delete pacote_adiado;
 }
 
 /**
  * @brief Carrega os dados da simulação a partir de um arquivo de entrada.
  * 
- * Lê as configurações de transporte, a matriz de adjacência dos armazéns e os detalhes
- * dos pacotes a serem simulados. Inicializa os objetos correspondentes.
+ * Lê as configurações de transporte, a topologia dos armazéns (matriz de adjacência ou
+ * lista de arestas) e os detalhes dos pacotes a serem simulados. Inicializa os objetos
+ * correspondentes. O arquivo é lido por `LeitorEntrada`, mapeado em memória.
+ *
+ * Sem janela (`opcoes.janela_pacotes` negativa), todos os pacotes são lidos aqui. Com janela,
+ * apenas o primeiro é lido, e o leitor fica aberto para que os demais sejam lidos durante a
+ * simulação, à medida que o relógio se aproxima dos seus tempos de postagem.
  * 
  * @param nome_arquivo O caminho para o arquivo de configuração.
+ * @throws std::runtime_error Se o arquivo não puder ser aberto ou estiver malformado.
  */
 void Simulacao::carregar_dados(const std::string& nome_arquivo) {
-    std::ifstream arquivo(nome_arquivo);
-    if (!arquivo.is_open()) {
-        std::cerr << "Erro ao abrir o arquivo de entrada." << std::endl;
-        return;
-    }
+    leitor_pacotes = new LeitorEntrada(nome_arquivo);
+    LeitorEntrada& arquivo = *leitor_pacotes;
 
     // Lê as configurações de transporte.
-    int capacidade, latencia, intervalo, custo_remocao;
-    arquivo >> capacidade >> latencia >> intervalo >> custo_remocao;
+    int capacidade = arquivo.ler_inteiro("capacidade de transporte");
+    int latencia = arquivo.ler_inteiro("latência de transporte");
+    int intervalo = arquivo.ler_inteiro("intervalo entre transportes");
+    int custo_remocao = arquivo.ler_inteiro("custo de remoção");
     transporte_config = new Transporte(capacidade, latencia, intervalo, custo_remocao);
 
-    // Lê a matriz de adjacência que define as rotas.
-    arquivo >> num_armazens;
-    matriz_adjacencia = new bool*[num_armazens];
-    for (int i = 0; i < num_armazens; ++i) {
-        matriz_adjacencia[i] = new bool[num_armazens];
-        for (int j = 0; j < num_armazens; ++j) {
-            arquivo >> matriz_adjacencia[i][j];
+    // Lê a topologia que define as rotas: uma matriz de adjacência ou, se o número de
+    // armazéns for seguido da palavra "arestas", uma lista de arestas.
+    num_armazens = arquivo.ler_inteiro("número de armazéns", 0);
+    VetorDinamico<int> origens_arestas, destinos_arestas;
+    if (arquivo.proximo_e_palavra()) {
+        arquivo.esperar_palavra("arestas");
+        int num_arestas = arquivo.ler_inteiro("número de arestas", 0);
+        // Cada aresta "u v" é bidirecional, como na matriz simétrica.
+        for (int e = 0; e < num_arestas; ++e) {
+            int u = arquivo.ler_inteiro("armazém da aresta", 0, num_armazens - 1);
+            int v = arquivo.ler_inteiro("armazém da aresta", 0, num_armazens - 1);
+            origens_arestas.adicionar(u);
+            destinos_arestas.adicionar(v);
+            origens_arestas.adicionar(v);
+            destinos_arestas.adicionar(u);
+        }
+    } else {
+        for (int i = 0; i < num_armazens; ++i) {
+            for (int j = 0; j < num_armazens; ++j) {
+                if (arquivo.ler_inteiro("entrada da matriz de adjacência", 0, 1)) {
+                    origens_arestas.adicionar(i);
+                    destinos_arestas.adicionar(j);
+                }
+            }
         }
     }
+    grafo.construir(num_armazens, origens_arestas, destinos_arestas);
 
-    // Inicializa os armazéns.
+    // Inicializa os armazéns e as posições (ainda vazias) das árvores de BFS. Cada armazém
+    // recebe uma seção por vizinho, nos dois sentidos de cada aresta, já que os transportes
+    // são agendados nos dois sentidos.
+    int* inicio_vizinhos = new int[num_armazens + 1]();
     for (int i = 0; i < num_armazens; ++i) {
-        armazens.adicionar(new Armazem(i, num_armazens));
+        grafo.para_cada_vizinho(i, [&](int j) {
+            inicio_vizinhos[i + 1]++;
+            inicio_vizinhos[j + 1]++;
+        });
+    }
+    for (int i = 0; i < num_armazens; ++i) inicio_vizinhos[i + 1] += inicio_vizinhos[i];
+    int* vizinhos = new int[inicio_vizinhos[num_armazens] > 0 ? inicio_vizinhos[num_armazens] : 1];
+    int* posicao = new int[num_armazens > 0 ? num_armazens : 1];
+    for (int i = 0; i < num_armazens; ++i) posicao[i] = inicio_vizinhos[i];
+    for (int i = 0; i < num_armazens; ++i) {
+        grafo.para_cada_vizinho(i, [&](int j) {
+            vizinhos[posicao[i]++] = j;
+            vizinhos[posicao[j]++] = i;
+        });
+    }
+    for (int i = 0; i < num_armazens; ++i) {
+        armazens.adicionar(new Armazem(i, vizinhos + inicio_vizinhos[i], inicio_vizinhos[i + 1] - inicio_vizinhos[i]));
+    }
+    rotas.configurar(num_armazens);
+    delete[] posicao;
+    delete[] vizinhos;
+    delete[] inicio_vizinhos;
+
+    // Lê os pacotes: o número total e, sem janela, todos eles.
+    int num_pacotes = arquivo.ler_inteiro("número de pacotes", 0);
+    pacotes_nao_lidos = num_pacotes;
+    pacotes_pendentes = num_pacotes;
+    metricas.num_pacotes = num_pacotes;
+    if (opcoes.janela_pacotes >= 0) {
+        pacote_adiado = proximo_pacote();
+        this->tempo_inicial = pacote_adiado ? pacote_adiado->tempo_postagem : 0;
+        return;
     }
 
-    // Lê e cria os pacotes da simulação.
-    int num_pacotes;
-    arquivo >> num_pacotes;
-    std::string linha, str_pac, str_org, str_dst;
-    int tempo, id, origem, destino;
-    for (int i = 0; i < num_pacotes; ++i) {
-        arquivo >> tempo >> str_pac >> id >> str_org >> origem >> str_dst >> destino;
-        id--;
-        pacotes.adicionar(new Pacote(id, tempo, origem, destino));
+    for (Pacote* p = ler_pacote(); p; p = ler_pacote()) {
+        pacotes_carregados.adicionar(p);
+    }
+    delete leitor_pacotes;
+    leitor_pacotes = nullptr;
+    this->tempo_inicial = num_pacotes > 0 ? pacotes_carregados[0]->tempo_postagem : 0;
+
+    // Normaliza entradas fora de ordem: os pacotes passam a ficar em ordem de postagem
+    // (ordenação estável, em tempo linear). O tempo inicial continua sendo o do primeiro
+    // pacote lido.
+    bool em_ordem = true;
+    for (int i = 1; i < pacotes_carregados.tamanho() && em_ordem; ++i) {
+        em_ordem = pacotes_carregados[i - 1]->tempo_postagem <= pacotes_carregados[i]->tempo_postagem;
+    }
+    if (!em_ordem) {
+        pacotes_carregados.ordenar_por_chave([](const Pacote* p) { return p->tempo_postagem; });
     }
-    this->tempo_inicial = pacotes[0]->tempo_postagem;
+    pacote_adiado = proximo_pacote();
 }
 
 /**
- * @brief Calcula a rota mais curta entre dois armazéns usando o algoritmo Breadth-First Search (BFS).
- * 
- * Percorre o grafo de armazéns para encontrar o caminho com o menor número de saltos.
- * 
- * @param origem O ID do armazém de partida.
- * @param destino O ID do armazém de chegada.
- * @return Um `VetorDinamico<int>` contendo a sequência de IDs de armazéns que formam a rota.
+ * @brief Lê o próximo pacote do arquivo.
+ *
+ * Cada pacote ocupa uma linha no formato "<tempo> pac <id> org <origem> dst <destino>".
+ * @return O pacote lido, ou nullptr se todos já foram lidos.
  */
-VetorDinamico<int> Simulacao::calcular_rota_bfs(int origem, int destino) {
-    Fila<int> fila; // Fila para o BFS.
-    VetorDinamico<int> antecessor(num_armazens); // Armazena o caminho.
-    VetorDinamico<bool> visitado(num_armazens); // Marca nós visitados.
-    for(int i = 0; i < num_armazens; ++i) {
-        antecessor.adicionar(-1);
-        visitado.adicionar(false);
-    }
-
-    fila.enfileirar(origem);
-    visitado[origem] = true;
-
-    // Loop principal do BFS.
-    while (!fila.esta_vazia()) {
-        int u = fila.desenfileirar();
-        if (u == destino) break; // Chegou ao destino.
-
-        for (int v = 0; v < num_armazens; ++v) {
-            if (matriz_adjacencia[u][v] && !visitado[v]) {
-                visitado[v] = true;
-                antecessor[v] = u;
-                fila.enfileirar(v);
-            }
+Pacote* Simulacao::ler_pacote() {
+    if (pacotes_nao_lidos == 0) return nullptr;
+    pacotes_nao_lidos--;
+
+    LeitorEntrada& arquivo = *leitor_pacotes;
+    int tempo = arquivo.ler_inteiro("tempo de postagem");
+    arquivo.esperar_palavra("pac");
+    int id = arquivo.ler_inteiro("ID do pacote") - 1;
+    arquivo.esperar_palavra("org");
+    int origem = arquivo.ler_inteiro("armazém de origem", 0, num_armazens - 1);
+    arquivo.esperar_palavra("dst");
+    int destino = arquivo.ler_inteiro("armazém de destino", 0, num_armazens - 1);
+    return new Pacote(id, tempo, origem, destino);
+}
+
+/**
+ * @brief Retorna o próximo pacote em ordem de postagem.
+ *
+ * Sem janela, os pacotes vêm de `pacotes_carregados`, já ordenados. Com janela, são lidos
+ * do arquivo um a um; como não há como reordená-los, a entrada precisa estar em ordem de
+ * postagem. O leitor é fechado assim que o último pacote é lido.
+ * @return O pacote, ou nullptr se não houver mais pacotes.
+ * @throws std::runtime_error Se, com janela, um pacote for postado antes do anterior.
+ */
+Pacote* Simulacao::proximo_pacote() {
+    if (!leitor_pacotes) {
+        if (proximo_carregado < pacotes_carregados.tamanho()) {
+            return pacotes_carregados[proximo_carregado++];
         }
+        return nullptr;
     }
 
-    // Reconstrói a rota a partir do destino usando o vetor de antecessores.
-    VetorDinamico<int> rota;
-    int atual = destino;
-    while (atual != -1) {
-        rota.adicionar(atual);
-        atual = antecessor[atual];
+    Pacote* p = ler_pacote();
+    if (!p) {
+        delete leitor_pacotes;
+        leitor_pacotes = nullptr;
+        return nullptr;
     }
+    if (p->tempo_postagem < ultimo_tempo_lido) {
+        std::string mensagem = "Com janela de leitura, os pacotes precisam estar em ordem de postagem: o pacote " +
+                               std::to_string(p->id + 1) + " foi postado em " + std::to_string(p->tempo_postagem) +
+                               ", antes do pacote anterior (" + std::to_string(ultimo_tempo_lido) + ").";
+        delete p;
+        throw std::runtime_error(mensagem);
+    }
+    ultimo_tempo_lido = p->tempo_postagem;
+    return p;
+}
 
-    // A rota foi construída de trás para frente, então precisa ser invertida.
-    VetorDinamico<int> rota_invertida;
-    for(int i = rota.tamanho() - 1; i >= 0; --i) {
-        rota_invertida.adicionar(rota[i]);
+/**
+ * @brief Agenda a chegada, no armazém de origem, de todos os pacotes postados até `tempo_limite`.
+ *
+ * Os pacotes recebem rota (em paralelo, ver `precalcular_rotas`) e uma posição em `pacotes`,
+ * reaproveitando as deixadas por entregas. Depois disso, todos os pacotes postados antes do
+ * próximo ainda não agendado estão no escalonador, o que é registrado em `horizonte_leitura`.
+ * @param tempo_limite Maior tempo de postagem a agendar.
+ * @param lote Recebe os eventos de chegada criados.
+ */
+void Simulacao::admitir_pacotes(long long tempo_limite, VetorDinamico<Evento>& lote) {
+    // Cada pacote entra em `pacotes` antes da leitura do seguinte, que pode lançar exceção.
+    VetorDinamico<Pacote*> novos;
+    while (pacote_adiado && pacote_adiado->tempo_postagem <= tempo_limite) {
+        Pacote* p = pacote_adiado;
+        pacote_adiado = nullptr;
+        if (posicoes_livres.esta_vazia()) {
+            p->posicao = pacotes.tamanho();
+            pacotes.adicionar(p);
+        } else {
+            p->posicao = posicoes_livres.desempilha();
+            pacotes[p->posicao] = p;
+        }
+        novos.adicionar(p);
+        pacote_adiado = proximo_pacote();
+    }
+    horizonte_leitura = pacote_adiado ? pacote_adiado->tempo_postagem - 1 : INT_MAX;
+    if (leitor_pacotes) leitor_pacotes->liberar_lidos();
+    if (!pacote_adiado) pacotes_carregados = VetorDinamico<Pacote*>();
+
+    precalcular_rotas(novos);
+    for (int i = 0; i < novos.tamanho(); ++i) {
+        Pacote* p = novos[i];
+        lote.adicionar(Evento::chegada(p->tempo_postagem, p->id, p->posicao, p->armazem_origem));
+    }
+}
+
+/**
+ * @brief Remove um pacote entregue de `pacotes` e libera sua memória.
+ *
+ * A posição do pacote fica disponível para o próximo pacote agendado, então `pacotes`
+ * cresce com o número de pacotes em circulação, e não com o total da entrada.
+ * @param pacote O pacote entregue.
+ */
+void Simulacao::liberar_pacote(Pacote* pacote) {
+    pacotes[pacote->posicao] = nullptr;
+    posicoes_livres.empilha(pacote->posicao);
+    delete pacote;
+}
+
+/**
+ * @brief Executa `tarefa(i)` para todo `i` em [0, total), dividindo o trabalho entre threads.
+ *
+ * Cada thread pega o próximo índice de um contador atômico, sem travas. Com uma única
+ * thread (ou pouco trabalho), tudo roda na thread atual.
+ * @param total Quantidade de tarefas.
+ * @param num_threads Número de threads desejado.
+ * @param tarefa Função chamada com o índice de cada tarefa.
+ */
+template <typename Tarefa>
+static void executar_em_paralelo(int total, int num_threads, Tarefa tarefa) {
+    if (num_threads > total) num_threads = total;
+    if (num_threads <= 1) {
+        for (int i = 0; i < total; ++i) tarefa(i);
+        return;
+    }
+
+    std::atomic<int> proximo(0);
+    auto trabalhador = [&]() {
+        for (int i = proximo++; i < total; i = proximo++) {
+            tarefa(i);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < num_threads; ++t) {
+        threads.emplace_back(trabalhador);
+    }
+    trabalhador();
+    for (size_t t = 0; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+}
+
+/**
+ * @brief Calcula as rotas de um lote de pacotes antes de agendá-los.
+ *
+ * Os pares (origem, destino) do lote que ainda não têm rota são agrupados por origem, e cada
+ * grupo é uma tarefa independente, executada em paralelo e sem travas: calcula a árvore de BFS
+ * da origem em um array da própria thread e monta, a partir dela, os caminhos de todos os
+ * pares do grupo. Assim, só existe uma árvore por thread, sobrescrita pelo grupo seguinte, e
+ * uma origem que aparece de novo em outro lote (com `--janela`) tem a árvore recalculada. Por
+ * fim, os caminhos entram em `rotas`, na ordem dos pares, e cada pacote recebe a posição da
+ * rota do seu par, compartilhada por todos os pacotes com a mesma origem e o mesmo destino.
+ *
+ * Como o BFS visita os vizinhos em ordem crescente de ID, o antecessor de cada armazém é o
+ * mesmo que uma busca interrompida ao alcançá-lo encontraria, então as rotas não mudam. Se o
+ * destino for inalcançável, a rota contém apenas o destino.
+ * @param novos Os pacotes que ainda não têm rota.
+ */
+void Simulacao::precalcular_rotas(const VetorDinamico<Pacote*>& novos) {
+    int num_threads = opcoes.num_threads;
+    if (num_threads <= 0) {
+        num_threads = (int)std::thread::hardware_concurrency();
+        if (num_threads <= 0) num_threads = 1;
+    }
+
+    // Reúne os pares sem rota. Um par pode aparecer em vários pacotes do lote; após a
+    // ordenação (por origem, depois por destino), só a primeira ocorrência de cada um é mantida.
+    VetorDinamico<long long> pares;
+    for (int i = 0; i < novos.tamanho(); ++i) {
+        int origem = novos[i]->armazem_origem;
+        int destino = novos[i]->armazem_destino;
+        if (rotas.procurar(origem, destino) == -1) {
+            pares.adicionar((long long)origem * num_armazens + destino);
+        }
+    }
+    pares.ordenar();
+    int distintos = 0;
+    for (int i = 0; i < pares.tamanho(); ++i) {
+        if (distintos == 0 || pares[i] != pares[distintos - 1]) pares[distintos++] = pares[i];
+    }
+
+    // Cada grupo é o intervalo [inicio_grupo[g], inicio_grupo[g + 1]) de pares da mesma origem.
+    VetorDinamico<int> inicio_grupo;
+    for (int i = 0; i < distintos; ++i) {
+        if (i == 0 || pares[i] / num_armazens != pares[i - 1] / num_armazens) inicio_grupo.adicionar(i);
+    }
+    int num_grupos = inicio_grupo.tamanho();
+    inicio_grupo.adicionar(distintos);
+
+    // Cada grupo escreve apenas o seu array de caminhos (concatenados, da origem ao destino) e
+    // as posições de `comprimentos` dos seus pares.
+    VetorDinamico<VetorDinamico<int>> caminhos;
+    caminhos.ajustar_tamanho(num_grupos);
+    VetorDinamico<int> comprimentos;
+    comprimentos.ajustar_tamanho(distintos);
+    executar_em_paralelo(num_grupos, num_threads, [&](int g) {
+        static thread_local VetorDinamico<int> arvore; // Reutilizada entre grupos e lotes.
+        arvore.ajustar_tamanho(num_armazens);
+        const int* antecessor = arvore.begin();
+        int origem = (int)(pares[inicio_grupo[g]] / num_armazens);
+        grafo.calcular_arvore_bfs(origem, arvore.begin());
+
+        VetorDinamico<int>& caminho = caminhos[g];
+        for (int k = inicio_grupo[g]; k < inicio_grupo[g + 1]; ++k) {
+            // Sobe do destino até a origem pelos antecessores e inverte o trecho.
+            int destino = (int)(pares[k] % num_armazens);
+            int fim = caminho.tamanho();
+            for (int atual = destino; atual != -1; atual = antecessor[atual]) caminho.adicionar(atual);
+            std::reverse(caminho.begin() + fim, caminho.end());
+            comprimentos[k] = caminho.tamanho() - fim;
+        }
+    });
+
+    // Guarda as rotas e libera os caminhos de cada grupo assim que são copiados.
+    for (int g = 0; g < num_grupos; ++g) {
+        const int* caminho = caminhos[g].begin();
+        for (int k = inicio_grupo[g]; k < inicio_grupo[g + 1]; ++k) {
+            rotas.adicionar((int)(pares[k] / num_armazens), (int)(pares[k] % num_armazens), caminho, comprimentos[k]);
+            caminho += comprimentos[k];
+        }
+        caminhos[g] = VetorDinamico<int>();
+    }
+
+    for (int i = 0; i < novos.tamanho(); ++i) {
+        Pacote* p = novos[i];
+        p->definir_rota(rotas.procurar(p->armazem_origem, p->armazem_destino));
     }
-    return rota_invertida;
 }
 
 /**
  * @brief Agenda os eventos iniciais da simulação.
  * 
- * Para cada pacote, calcula sua rota e agenda um `EventoChegada` no armazém de origem.
- * Também agenda os `EventoTransporte` iniciais para todas as rotas de transporte ativas.
+ * Agenda a chegada no armazém de origem dos pacotes postados até o fim da primeira janela de
+ * leitura (todos, sem janela), com as rotas já calculadas. Também agenda o primeiro ciclo
+ * periódico de transportes (ou, sem intervalo positivo, o primeiro transporte de cada rota).
  */
 void Simulacao::agendar_eventos_iniciais() {
-    // Agenda a chegada inicial de cada pacote em seu armazém de origem.
-    for (int i = 0; i < pacotes.tamanho(); ++i) {
-        Pacote* p = pacotes[i];
-        VetorDinamico<int> rota = calcular_rota_bfs(p->armazem_origem, p->armazem_destino);
-        p->definir_rota(rota);
-        escalonador->insere_evento(new EventoChegada(p->tempo_postagem, p->id, p->armazem_origem));
-    }
+    // Os eventos iniciais são reunidos em um lote e entregues ao escalonador de uma vez.
+    VetorDinamico<Evento> lote;
 
-    // Agenda o primeiro evento de transporte para cada rota bidirecional.
-    if (!transporte_config) return;
-    for (int i = 0; i < num_armazens; ++i) {
-        for (int j = i + 1; j < num_armazens; ++j) { // j = i + 1 para evitar duplicatas.
-            if (matriz_adjacencia[i][j]) {
-                escalonador->insere_evento(new EventoTransporte(this->tempo_inicial + transporte_config->intervalo, i, j));
-                escalonador->insere_evento(new EventoTransporte(this->tempo_inicial + transporte_config->intervalo, j, i));
+    // Agenda a chegada inicial de cada pacote em seu armazém de origem.
+    long long tempo_limite = opcoes.janela_pacotes < 0 ? LLONG_MAX : (long long)tempo_inicial + opcoes.janela_pacotes;
+    admitir_pacotes(tempo_limite, lote);
+
+    // Agenda os transportes periódicos: com intervalo positivo, um único evento de ciclo que
+    // percorre todas as rotas; sem ele, um evento por rota bidirecional. Sob demanda, as
+    // rotas começam adormecidas e só são agendadas quando recebem o primeiro pacote.
+    if (transporte_config && opcoes.modo_transporte == ModoTransporte::PERIODICO) {
+        int tempo_transporte = this->tempo_inicial + transporte_config->intervalo;
+        if (transporte_config->intervalo > 0) {
+            montar_rotas_transporte();
+            if (rotas_transporte.tamanho() > 0) {
+                const RotaTransporte& primeira = rotas_transporte[0];
+                lote.adicionar(Evento::ciclo_transportes(tempo_transporte, 0, primeira.origem, primeira.destino));
+            }
+        } else {
+            for (int i = 0; i < num_armazens; ++i) {
+                grafo.para_cada_vizinho(i, [&](int j) {
+                    if (j > i) { // j > i para evitar duplicatas.
+                        lote.adicionar(Evento::transporte(tempo_transporte, i, j));
+                        lote.adicionar(Evento::transporte(tempo_transporte, j, i));
+                    }
+                });
             }
         }
     }
+
+    escalonador->insere_eventos(lote);
 }
 
 /**
@@ -190,24 +500,47 @@ void Simulacao::agendar_eventos_iniciais() {
  * O tempo da simulação avança conforme os eventos são processados.
  */
 void Simulacao::executar() {
-    last_line_buffer = "";
-    // Loop continua enquanto houver eventos na fila de prioridade.
-    while (!escalonador->vazio()) {
-        if (todos_pacotes_entregues()) break;
+    // Loop continua enquanto houver eventos na fila de prioridade ou pacotes a agendar.
+    Evento evento;
+    VetorDinamico<Evento> lote;
+    while (!todos_pacotes_entregues()) {
+        if (escalonador->vazio()) {
+            if (!pacote_adiado) break;
+            lote.limpar();
+            admitir_pacotes((long long)pacote_adiado->tempo_postagem + opcoes.janela_pacotes, lote);
+            escalonador->insere_eventos(lote);
+            continue;
+        }
 
-        Evento* evento = escalonador->retira_proximo_evento();
-        tempo_atual = evento->tempo; // Avança o relógio da simulação.
+        escalonador->retira_proximo_evento(evento);
+        if (evento.tempo > horizonte_leitura) {
+            // Pacotes ainda não lidos podem chegar antes deste evento: agenda a próxima janela
+            // e devolve o evento à fila, para que a ordem seja a mesma da leitura completa.
+            lote.limpar();
+            lote.adicionar(evento);
+            admitir_pacotes((long long)evento.tempo + opcoes.janela_pacotes, lote);
+            escalonador->insere_eventos(lote);
+            continue;
+        }
+        tempo_atual = evento.tempo; // Avança o relógio da simulação.
+        if (evento.chave > chave_maxima_processada) chave_maxima_processada = evento.chave;
         // Direciona o evento para a função de processamento correta.
-        if (evento->tipo == TipoEvento::CHEGADA_PACOTE) {
-            processar_evento_chegada(static_cast<EventoChegada*>(evento));
-        } else if (evento->tipo == TipoEvento::TRANSPORTE_PACOTES) {
-            processar_evento_transporte(static_cast<EventoTransporte*>(evento));
+        switch (evento.tipo) {
+            case TipoEvento::CHEGADA_PACOTE:
+                processar_evento_chegada(evento);
+                break;
+            case TipoEvento::TRANSPORTE_PACOTES:
+                processar_evento_transporte(evento);
+                break;
+            case TipoEvento::CICLO_TRANSPORTES:
+                processar_ciclo_transportes(evento);
+                break;
         }
-        delete evento; // Libera a memória do evento processado.
     }
-    if (!last_line_buffer.empty()) {
-        std::cout << last_line_buffer;
+    if (opcoes.formato_log == FormatoLog::RESUMO) {
+        escrever_resumo();
     }
+    saida.descarregar();
 }
 
 /**
@@ -217,144 +550,239 @@ void Simulacao::executar() {
  * ao seu destino final, ele é marcado como ENTREGUE. Caso contrário, ele é armazenado
  * para futuro transporte.
  * 
- * @param evento O ponteiro para o `EventoChegada` a ser processado.
+ * @param evento O evento de chegada a ser processado.
  */
-void Simulacao::processar_evento_chegada(EventoChegada* evento) {
-    Pacote* pacote = nullptr;
-    // Encontra o pacote correspondente ao evento.
-    for (int i = 0; i < pacotes.tamanho(); ++i) {
-        if (pacotes[i]->id == evento->id_pacote) {
-            pacote = pacotes[i];
-            break;
-        }
-    }
+void Simulacao::processar_evento_chegada(const Evento& evento) {
+    Pacote* pacote = pacotes[evento.posicao_pacote()];
 
     if (!pacote) return; // Segurança: se o pacote não for encontrado, ignora.
 
     // Garante que o pacote avance em sua rota planejada.
-    if (pacote->obter_proximo_destino() == evento->id_armazem) {
-        pacote->avancar_rota();
+    if (pacote->obter_proximo_destino(rotas) == evento.id_armazem()) {
+        pacote->avancar_rota(rotas);
     }
 
     // Verifica se o armazém atual é o destino final do pacote.
-    std::stringstream ss;
-    if (evento->id_armazem == pacote->armazem_destino) {
+    if (evento.id_armazem() == pacote->armazem_destino) {
+        if (pacote->estado_atual != EstadoPacote::ENTREGUE) {
+            pacotes_pendentes--;
+        }
         pacote->atualizar_estado(EstadoPacote::ENTREGUE);
-        ss << std::setw(7) << std::setfill('0') << (int)tempo_atual << " pacote " << std::setw(3) << std::setfill('0') << pacote->display_id << " entregue em " << std::setw(3) << std::setfill('0') << evento->id_armazem;
+        registrar_log((int)tempo_atual, pacote, OperacaoLog::ENTREGUE, evento.id_armazem());
+        liberar_pacote(pacote);
     } else {
         // Se não for o destino final, armazena o pacote na seção correta.
-        armazens[evento->id_armazem]->armazenar_pacote(pacote);
-        ss << std::setw(7) << std::setfill('0') << (int)tempo_atual << " pacote " << std::setw(3) << std::setfill('0') << pacote->display_id << " armazenado em " << std::setw(3) << std::setfill('0') << evento->id_armazem << " na secao " << std::setw(3) << std::setfill('0') << pacote->obter_proximo_destino();
+        int proximo_destino = pacote->obter_proximo_destino(rotas);
+        bool secao_estava_vazia = armazens[evento.id_armazem()]->armazenar_pacote(pacote, proximo_destino);
+        pacote->inicio_armazenamento = (int)tempo_atual;
+        registrar_log((int)tempo_atual, pacote, OperacaoLog::ARMAZENADO, evento.id_armazem(), proximo_destino);
+        if (secao_estava_vazia && opcoes.modo_transporte == ModoTransporte::SOB_DEMANDA) {
+            // Uma chegada criada por um transporte de latência zero pode ter chave menor que a
+            // de eventos já processados: a grade só continua depois da maior chave retirada.
+            long long chave_limite = evento.chave > chave_maxima_processada ? evento.chave : chave_maxima_processada;
+            agendar_transporte_sob_demanda(evento.id_armazem(), proximo_destino, chave_limite);
+        }
+    }
+}
+
+/**
+ * @brief Agenda o transporte de uma rota adormecida no próximo instante da grade periódica.
+ *
+ * No modo periódico, a rota teria eventos em `tempo_inicial + k·intervalo` (k ≥ 1), e os de
+ * chave menor que a maior chave já retirada do escalonador já teriam sido processados com a
+ * seção vazia, sem nenhum efeito. O transporte é agendado, então, no primeiro instante da
+ * grade cuja chave é maior que `chave_limite`, calculado diretamente a partir da chave, e a
+ * saída é a mesma do modo periódico. A chave do evento atual não basta: com latência e custo
+ * de remoção zero, uma chegada criada por um transporte tem o mesmo tempo e pode ter chave
+ * menor que a dele.
+ * Rotas que o modo periódico não agenda (ver `agendar_eventos_iniciais`) continuam sem eventos.
+ * @param origem ID do armazém de origem da rota.
+ * @param destino ID do armazém de destino da rota.
+ * @param chave_limite Maior chave já retirada do escalonador (incluindo a do evento atual).
+ */
+void Simulacao::agendar_transporte_sob_demanda(int origem, int destino, long long chave_limite) {
+    int menor = origem < destino ? origem : destino;
+    int maior = origem < destino ? destino : origem;
+    if (!grafo.tem_aresta(menor, maior)) return;
+
+    // Menor tempo t com chave_transporte(t, origem, destino) > chave_limite (divisão arredondada para baixo).
+    long long resto = chave_limite - Evento::chave_transporte(0, origem, destino);
+    long long tempo_minimo = (resto >= 0 ? resto / Evento::PESO_TEMPO : -((-resto + Evento::PESO_TEMPO - 1) / Evento::PESO_TEMPO)) + 1;
+
+    // Primeiro instante da grade a partir de `tempo_minimo`.
+    long long intervalo = transporte_config->intervalo;
+    long long tempo = (long long)tempo_inicial + intervalo;
+    if (tempo_minimo > tempo) {
+        tempo += (tempo_minimo - tempo + intervalo - 1) / intervalo * intervalo;
     }
-    print_log_line(ss.str());
+    escalonador->insere_evento(Evento::transporte((int)tempo, origem, destino));
 }
 
 /**
  * @brief Verifica se todos os pacotes da simulação foram entregues.
  * 
- * Itera sobre todos os pacotes e verifica se o estado de cada um é `ENTREGUE`.
+ * O contador de pendentes é decrementado sempre que um pacote passa para `ENTREGUE`,
+ * então a verificação não precisa percorrer os pacotes.
  * 
  * @return `true` se todos os pacotes foram entregues, `false` caso contrário.
  */
 bool Simulacao::todos_pacotes_entregues() const {
-    for (int i = 0; i < pacotes.tamanho(); ++i) {
-        if (pacotes[i]->estado_atual != EstadoPacote::ENTREGUE) {
-            return false;
-        }
-    }
-    return true;
+    return pacotes_pendentes == 0;
+}
+
+/**
+ * @brief Retorna quantos pacotes ainda não foram entregues.
+ *
+ * @return O número de pacotes pendentes.
+ */
+int Simulacao::obter_pacotes_pendentes() const {
+    return pacotes_pendentes;
 }
 
 /**
  * @brief Processa um evento de transporte de pacotes entre dois armazéns.
  * 
- * Seleciona pacotes de uma seção de um armazém para transporte, com base na capacidade
- * do veículo e na ordem de postagem. Agenda novos eventos de chegada para os pacotes
- * transportados e reagenda um novo evento de transporte para o futuro.
+ * Transporta os pacotes da seção (ver `transportar_pacotes`) e reagenda um novo evento de
+ * transporte para o futuro. Usado pelas rotas sob demanda e, sem intervalo positivo, pelo
+ * modo periódico; com intervalo positivo, o modo periódico usa o ciclo de transportes.
  * 
- * @param evento O ponteiro para o `EventoTransporte` a ser processado.
+ * @param evento O evento de transporte a ser processado.
  */
-#include <cmath> // Para std::round
-
-void Simulacao::processar_evento_transporte(EventoTransporte* evento) {
+void Simulacao::processar_evento_transporte(const Evento& evento) {
     if (todos_pacotes_entregues() || !this->transporte_config) {
         return;
     }
 
-    this->tempo_atual = evento->tempo;
-    Armazem* armazem_origem = armazens[evento->id_armazem_origem];
-    Pilha<Pacote*>& secao = armazem_origem->obter_secao(evento->id_armazem_destino);
+    const int origem = evento.id_armazem_origem();
+    const int destino = evento.id_armazem_destino();
+    Pilha<Pacote*>& secao = armazens[origem]->obter_secao(destino);
+    transportar_pacotes(evento.tempo, origem, destino, secao);
 
-    if (secao.esta_vazia()) {
-        if (!todos_pacotes_entregues()) {
-            escalonador->insere_evento(new EventoTransporte(this->tempo_atual + this->transporte_config->intervalo, evento->id_armazem_origem, evento->id_armazem_destino));
-        }
-        return;
+    // Sob demanda, a rota adormece quando a seção fica vazia.
+    if (!todos_pacotes_entregues() &&
+        (opcoes.modo_transporte == ModoTransporte::PERIODICO || !secao.esta_vazia())) {
+        escalonador->insere_evento(Evento::transporte(evento.tempo + this->transporte_config->intervalo, origem, destino));
     }
+}
 
-    VetorDinamico<Pacote*> pacotes_na_pilha;
-    while (!secao.esta_vazia()) {
-        pacotes_na_pilha.adicionar(secao.desempilha());
+/**
+ * @brief Monta a lista de rotas percorrida pelo ciclo periódico de transportes.
+ *
+ * Cada aresta `i -> j` com `j > i` dá as rotas `i -> j` e `j -> i`, as mesmas que teriam
+ * eventos de transporte individuais. As rotas são ordenadas (de forma estável) pela parte
+ * da chave de transporte que não depende do tempo, então percorrê-las em ordem é percorrer
+ * os transportes de um mesmo instante na ordem em que o escalonador os retiraria.
+ */
+void Simulacao::montar_rotas_transporte() {
+    rotas_transporte.limpar();
+    auto adicionar_rota = [&](int origem, int destino) {
+        RotaTransporte rota;
+        rota.chave = Evento::chave_transporte(0, origem, destino);
+        rota.origem = origem;
+        rota.destino = destino;
+        rota.secao = &armazens[origem]->obter_secao(destino);
+        rotas_transporte.adicionar(rota);
+    };
+    for (int i = 0; i < num_armazens; ++i) {
+        grafo.para_cada_vizinho(i, [&](int j) {
+            if (j > i) {
+                adicionar_rota(i, j);
+                adicionar_rota(j, i);
+            }
+        });
     }
+    rotas_transporte.ordenar_por_chave([](const RotaTransporte& rota) { return rota.chave; });
+}
 
-    double tempo_operacao_atual = evento->tempo;
-    for (int i = 0; i < pacotes_na_pilha.tamanho(); i++) {
-        tempo_operacao_atual += this->transporte_config->custo_remocao;
-        Pacote* p = pacotes_na_pilha[i];
-        std::stringstream ss;
-        ss << std::setw(7) << std::setfill('0') << (int)round(tempo_operacao_atual) 
-           << " pacote " << std::setw(3) << std::setfill('0') << p->display_id 
-           << " removido de " << std::setw(3) << std::setfill('0') << evento->id_armazem_origem 
-           << " na secao " << std::setw(3) << std::setfill('0') << evento->id_armazem_destino;
-        print_log_line(ss.str());
+/**
+ * @brief Processa o ciclo periódico de transportes de um instante.
+ *
+ * Um único evento representa todos os transportes de um instante da grade: ele tem a chave
+ * do transporte da próxima rota a processar e, ao ser retirado, percorre as rotas em ordem
+ * de chave, transportando as seções não vazias (uma seção vazia não teria efeito). Antes de
+ * cada rota, a chave dela é comparada com a menor chave pendente no escalonador; se outro
+ * evento vem antes (uma chegada no mesmo instante, por exemplo), o ciclo volta à fila com a
+ * chave dessa rota e continua depois dele. Ao fim da lista, o ciclo é reagendado para o
+ * próximo instante da grade. Assim, a ordem de processamento é a mesma dos eventos
+ * individuais por rota, com uma inserção por ciclo (mais uma por interrupção) em vez de uma
+ * por rota.
+ * @param evento O evento do ciclo.
+ */
+void Simulacao::processar_ciclo_transportes(const Evento& evento) {
+    if (todos_pacotes_entregues()) {
+        return;
     }
 
-    double tempo_final_operacao = tempo_operacao_atual;
+    const long long base = (long long)evento.tempo * Evento::PESO_TEMPO;
+    const int num_rotas = rotas_transporte.tamanho();
+    long long proxima_chave;
+    if (!escalonador->consulta_proxima_chave(proxima_chave)) proxima_chave = LLONG_MAX;
 
-    VetorDinamico<Pacote*> para_transportar;
-    for (int i = pacotes_na_pilha.tamanho() - 1; i >= 0 && para_transportar.tamanho() < this->transporte_config->capacidade; --i) {
-        para_transportar.adicionar(pacotes_na_pilha[i]);
+    for (int i = evento.indice_rota(); i < num_rotas; ++i) {
+        RotaTransporte& rota = rotas_transporte.sem_verificacao(i);
+        if (base + rota.chave > proxima_chave) {
+            escalonador->insere_evento(Evento::ciclo_transportes(evento.tempo, i, rota.origem, rota.destino));
+            return;
+        }
+        if (rota.secao->esta_vazia()) continue;
+
+        transportar_pacotes(evento.tempo, rota.origem, rota.destino, *rota.secao);
+        // As chegadas agendadas pelo transporte podem vir antes das próximas rotas.
+        if (!escalonador->consulta_proxima_chave(proxima_chave)) proxima_chave = LLONG_MAX;
     }
 
-    for (int i = 0; i < para_transportar.tamanho(); ++i) {
-        Pacote* p = para_transportar[i];
-        p->atualizar_estado(EstadoPacote::REMOVIDO_PARA_TRANSPORTE);
-        std::stringstream ss;
-        ss << std::setw(7) << std::setfill('0') << (int)round(tempo_final_operacao) 
-           << " pacote " << std::setw(3) << std::setfill('0') << p->display_id 
-           << " em transito de " << std::setw(3) << std::setfill('0') << evento->id_armazem_origem 
-           << " para " << std::setw(3) << std::setfill('0') << evento->id_armazem_destino;
-        print_log_line(ss.str());
-        escalonador->insere_evento(new EventoChegada(round(tempo_final_operacao) + this->transporte_config->latencia, p->id, evento->id_armazem_destino));
-    }
-
-    VetorDinamico<Pacote*> pacotes_a_reempilhar_log;
-    for (int i = pacotes_na_pilha.tamanho() - 1; i >= 0; i--) {
-        Pacote* p = pacotes_na_pilha[i];
-        bool foi_transportado = false;
-        for (int j = 0; j < para_transportar.tamanho(); ++j) {
-            if (p->id == para_transportar[j]->id) {
-                foi_transportado = true;
-                break;
-            }
-        }
-        if (!foi_transportado) {
-            secao.empilha(p);
-            pacotes_a_reempilhar_log.adicionar(p);
-        }
+    const RotaTransporte& primeira = rotas_transporte[0];
+    escalonador->insere_evento(Evento::ciclo_transportes(evento.tempo + transporte_config->intervalo, 0,
+                                                         primeira.origem, primeira.destino));
+}
+
+/**
+ * @brief Transporta os pacotes de uma seção de um armazém para o armazém de destino.
+ * 
+ * Seleciona pacotes da seção para transporte, com base na capacidade do veículo e na ordem
+ * de postagem, e agenda os eventos de chegada dos pacotes transportados.
+ *
+ * A seção é lida no lugar, por posição a partir da base, sem desempilhar nem copiar:
+ * todos os pacotes são removidos (do topo para a base, cada um custando `custo_remocao`),
+ * os `capacidade` mais antigos (da base) seguem viagem e os demais são rearmazenados na
+ * mesma ordem relativa. Como o resultado é a seção sem os pacotes da base, basta
+ * descartá-los ao final. O custo é linear no tamanho da seção, sem alocações.
+ * 
+ * @param tempo O tempo do transporte.
+ * @param origem ID do armazém de origem.
+ * @param destino ID do armazém de destino.
+ * @param secao A seção da origem com os pacotes para o destino.
+ */
+void Simulacao::transportar_pacotes(int tempo, int origem, int destino, Pilha<Pacote*>& secao) {
+    this->tempo_atual = tempo;
+    const int quantidade = secao.obter_tamanho();
+    int a_transportar = this->transporte_config->capacidade;
+    if (a_transportar > quantidade) a_transportar = quantidade;
+    if (a_transportar < 0) a_transportar = 0;
+
+    // Remoção: do topo para a base, acumulando o custo de cada remoção.
+    double tempo_operacao_atual = tempo;
+    for (int i = quantidade - 1; i >= 0; --i) {
+        tempo_operacao_atual += this->transporte_config->custo_remocao;
+        Pacote* p = secao.elemento_da_base(i);
+        registrar_log((int)round(tempo_operacao_atual), p, OperacaoLog::REMOVIDO, origem, destino);
     }
 
-    for (int i = 0; i < pacotes_a_reempilhar_log.tamanho(); i++) {
-        Pacote* p = pacotes_a_reempilhar_log[i];
-        std::stringstream ss;
-        ss << std::setw(7) << std::setfill('0') << (int)round(tempo_final_operacao) 
-           << " pacote " << std::setw(3) << std::setfill('0') << p->display_id 
-           << " rearmazenado em " << std::setw(3) << std::setfill('0') << evento->id_armazem_origem 
-           << " na secao " << std::setw(3) << std::setfill('0') << evento->id_armazem_destino;
-        print_log_line(ss.str());
+    const int tempo_final_operacao = (int)round(tempo_operacao_atual);
+
+    // Transporte: os pacotes mais antigos, a partir da base.
+    for (int i = 0; i < a_transportar; ++i) {
+        Pacote* p = secao.elemento_da_base(i);
+        p->atualizar_estado(EstadoPacote::REMOVIDO_PARA_TRANSPORTE);
+        int periodo_armazenado = tempo_final_operacao - p->inicio_armazenamento;
+        metricas.tempo_total_armazenado += periodo_armazenado;
+        registrar_log(tempo_final_operacao, p, OperacaoLog::EM_TRANSITO, origem, destino);
+        escalonador->insere_evento(Evento::chegada(tempo_final_operacao + this->transporte_config->latencia, p->id, p->posicao, destino));
     }
 
-    if (!todos_pacotes_entregues()) {
-        escalonador->insere_evento(new EventoTransporte(this->tempo_atual + this->transporte_config->intervalo, evento->id_armazem_origem, evento->id_armazem_destino));
+    // Rearmazenamento: os demais, da base para o topo, voltam à seção na mesma ordem.
+    for (int i = a_transportar; i < quantidade; ++i) {
+        registrar_log(tempo_final_operacao, secao.elemento_da_base(i), OperacaoLog::REARMAZENADO, origem, destino);
     }
+    secao.remover_da_base(a_transportar);
 }
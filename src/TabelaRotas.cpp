@@ -0,0 +1,117 @@
+#include "../include/TabelaRotas.hpp"
+
+/**
+ * @brief Espalha o código de um par (hash multiplicativo de Fibonacci, bits altos).
+ *
+ * Os bits altos do produto dependem de todos os bits do código; os baixos, só dos baixos,
+ * o que faria colidir os pares com o mesmo destino quando o número de armazéns é potência de 2.
+ */
+static inline unsigned int espalhar(long long codigo) {
+    return (unsigned int)(((unsigned long long)codigo * 11400714819323198485ull) >> 32);
+}
+
+/**
+ * @brief Constrói uma tabela vazia, para uma rede sem armazéns.
+ */
+TabelaRotas::TabelaRotas() : saltos_curtos(true), num_armazens(0), tabela_pares(nullptr), mascara_tabela(0) {
+    configurar(0);
+}
+
+/**
+ * @brief Destrói a tabela, liberando a tabela de espalhamento.
+ */
+TabelaRotas::~TabelaRotas() {
+    delete[] tabela_pares;
+}
+
+/**
+ * @brief Descarta as rotas existentes e prepara a tabela para uma rede de `num_armazens`.
+ *
+ * A posição 0 do array de saltos recebe um marcador de fim: é a rota vazia (`ROTA_VAZIA`).
+ * @param num_armazens O número de armazéns; com até 65535, os saltos ocupam 16 bits.
+ */
+void TabelaRotas::configurar(int num_armazens) {
+    this->num_armazens = num_armazens;
+    saltos_curtos = num_armazens <= 0xFFFF;
+    saltos16 = VetorDinamico<unsigned short>();
+    saltos32 = VetorDinamico<int>();
+    if (saltos_curtos) {
+        saltos16.adicionar(0xFFFF);
+    } else {
+        saltos32.adicionar(-1);
+    }
+    pares.limpar();
+    inicio_rota.limpar();
+
+    delete[] tabela_pares;
+    mascara_tabela = 15;
+    tabela_pares = new int[mascara_tabela + 1];
+    for (int i = 0; i <= mascara_tabela; ++i) tabela_pares[i] = -1;
+}
+
+/**
+ * @brief Retorna a posição de `codigo` na tabela: a sua entrada ou a vaga onde entraria.
+ * @param codigo O código `origem * num_armazens + destino` do par.
+ * @return Uma posição da tabela cuja entrada é o par ou -1.
+ */
+int TabelaRotas::sondar(long long codigo) const {
+    unsigned int posicao = espalhar(codigo) & mascara_tabela;
+    while (tabela_pares[posicao] != -1 && pares.sem_verificacao(tabela_pares[posicao]) != codigo) {
+        posicao = (posicao + 1) & mascara_tabela;
+    }
+    return (int)posicao;
+}
+
+/**
+ * @brief Dobra a tabela de espalhamento e reinsere as rotas existentes.
+ */
+void TabelaRotas::crescer_tabela() {
+    delete[] tabela_pares;
+    mascara_tabela = 2 * mascara_tabela + 1;
+    tabela_pares = new int[mascara_tabela + 1];
+    for (int i = 0; i <= mascara_tabela; ++i) tabela_pares[i] = -1;
+    for (int i = 0; i < pares.tamanho(); ++i) {
+        tabela_pares[sondar(pares[i])] = i;
+    }
+}
+
+/**
+ * @brief Procura a rota de um par.
+ * @param origem O ID do armazém de origem.
+ * @param destino O ID do armazém de destino.
+ * @return A posição do primeiro salto da rota, ou -1 se o par ainda não tiver rota.
+ */
+int TabelaRotas::procurar(int origem, int destino) const {
+    int indice = tabela_pares[sondar((long long)origem * num_armazens + destino)];
+    return indice == -1 ? -1 : inicio_rota.sem_verificacao(indice);
+}
+
+/**
+ * @brief Acrescenta a rota de um par que ainda não tem rota.
+ *
+ * A tabela de espalhamento dobra sempre que passaria de metade ocupada, o que mantém as
+ * sondagens curtas.
+ * @param origem O ID do armazém de origem.
+ * @param destino O ID do armazém de destino.
+ * @param caminho Os armazéns da rota, da origem ao destino.
+ * @param comprimento O número de armazéns em `caminho`.
+ * @return A posição do primeiro salto da rota.
+ */
+int TabelaRotas::adicionar(int origem, int destino, const int* caminho, int comprimento) {
+    if (2 * (pares.tamanho() + 1) > mascara_tabela + 1) crescer_tabela();
+
+    long long codigo = (long long)origem * num_armazens + destino;
+    int inicio = num_saltos();
+    tabela_pares[sondar(codigo)] = pares.tamanho();
+    pares.adicionar(codigo);
+    inicio_rota.adicionar(inicio);
+
+    if (saltos_curtos) {
+        for (int i = 0; i < comprimento; ++i) saltos16.adicionar((unsigned short)caminho[i]);
+        saltos16.adicionar(0xFFFF);
+    } else {
+        for (int i = 0; i < comprimento; ++i) saltos32.adicionar(caminho[i]);
+        saltos32.adicionar(-1);
+    }
+    return inicio;
+}
@@ -1,4 +1,5 @@
 #include "../include/Transporte.hpp"
+#include <stdexcept>
 
 /**
  * @brief Constrói um novo objeto Transporte.
@@ -10,3 +11,15 @@
  */
 Transporte::Transporte(int cap, int lat, int interv, int custo)
     : capacidade(cap), latencia(lat), intervalo(interv), custo_remocao(custo) {}
+
+/**
+ * @brief Converte o nome de um modo de transporte em seu tipo.
+ * @param nome "periodico" ou "sob-demanda".
+ * @return O modo correspondente.
+ * @throws std::invalid_argument Se o nome não corresponder a nenhum modo.
+ */
+ModoTransporte modo_transporte_por_nome(const std::string& nome) {
+    if (nome == "periodico") return ModoTransporte::PERIODICO;
+    if (nome == "sob-demanda") return ModoTransporte::SOB_DEMANDA;
+    throw std::invalid_argument("Modo de transporte desconhecido: " + nome);
+}
@@ -1,14 +1,65 @@
 #include <iostream>
+#include <string>
 #include "../include/Simulacao.hpp"
 
-int main(int argc, char* argv[]) {
-    if (argc != 2) {
-        std::cerr << "Uso: " << argv[0] << " <arquivo_de_entrada>" << std::endl;
-        return 1;
+/**
+ * @brief Reconhece uma opção de linha de comando nas formas `--nome valor` e `--nome=valor`.
+ * @param argc Número de argumentos.
+ * @param argv Argumentos.
+ * @param i Índice do argumento atual; avança se o valor estiver no argumento seguinte.
+ * @param nome Nome da opção, incluindo o prefixo `--`.
+ * @param valor Recebe o valor da opção.
+ * @return Verdadeiro se o argumento atual é a opção pedida.
+ */
+static bool ler_opcao(int argc, char* argv[], int& i, const std::string& nome, std::string& valor) {
+    std::string arg = argv[i];
+    if (arg == nome && i + 1 < argc) {
+        valor = argv[++i];
+        return true;
     }
+    if (arg.compare(0, nome.size() + 1, nome + "=") == 0) {
+        valor = arg.substr(nome.size() + 1);
+        return true;
+    }
+    return false;
+}
+
+int main(int argc, char* argv[]) {
+    const std::string uso = std::string("Uso: ") + argv[0] +
+        " [--escalonador heap|calendario|radix] [--threads N] [--log texto|binario|binario-delta|resumo] [--janela T] [--transportes periodico|sob-demanda] <arquivo_de_entrada>";
 
     try {
-        Simulacao sim(argv[1]);
+        OpcoesSimulacao opcoes;
+        std::string arquivo, valor;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (ler_opcao(argc, argv, i, "--escalonador", valor)) {
+                opcoes.escalonador = Escalonador::tipo_por_nome(valor);
+            } else if (ler_opcao(argc, argv, i, "--threads", valor)) {
+                opcoes.num_threads = std::stoi(valor);
+            } else if (ler_opcao(argc, argv, i, "--log", valor)) {
+                opcoes.formato_log = formato_log_por_nome(valor);
+            } else if (ler_opcao(argc, argv, i, "--transportes", valor)) {
+                opcoes.modo_transporte = modo_transporte_por_nome(valor);
+            } else if (ler_opcao(argc, argv, i, "--janela", valor)) {
+                opcoes.janela_pacotes = std::stoi(valor);
+                if (opcoes.janela_pacotes < 0) {
+                    std::cerr << uso << std::endl;
+                    return 1;
+                }
+            } else if (arquivo.empty() && arg.compare(0, 2, "--") != 0) {
+                arquivo = arg;
+            } else {
+                std::cerr << uso << std::endl;
+                return 1;
+            }
+        }
+        if (arquivo.empty()) {
+            std::cerr << uso << std::endl;
+            return 1;
+        }
+
+        Simulacao sim(arquivo, opcoes);
         sim.executar();
     } catch (const std::exception& e) {
         std::cerr << "Ocorreu um erro: " << e.what() << std::endl;